@@ -53,7 +53,7 @@ GtProcessMonitoringItem::GtProcessMonitoringItem(GtAbstractProperty* prop) :
 void
 GtProcessMonitoringItem::onObjectDataChange()
 {
-    emit dataChanged(this);
+    notifyDataChanged();
 }
 
 GtProcessMonitoringItem::ItemType
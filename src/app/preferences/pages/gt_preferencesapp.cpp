@@ -21,6 +21,7 @@
 #include "gt_logmodel.h"
 #include "gt_logging.h"
 #include "gt_icons.h"
+#include "gt_xmlutilities.h"
 
 #include "gt_preferencesapp.h"
 #include <QStandardItemModel>
@@ -102,12 +103,15 @@ GtPreferencesApp::GtPreferencesApp() :
                                            "project on startup"));
     m_openWelcomePage = new QCheckBox(tr("Show welcome page"));
     m_updateAtStartup = new QCheckBox(tr("Search for Updates on startup"));
+    m_storeBinaryLists = new QCheckBox(tr("Store large number lists binary "
+                                          "(not readable by older versions)"));
 
     QVBoxLayout* generalLayout = new QVBoxLayout(generalPage);
 
     generalLayout->addWidget(m_lastOpenedProject);
     generalLayout->addWidget(m_openWelcomePage);
     generalLayout->addWidget(m_updateAtStartup);
+    generalLayout->addWidget(m_storeBinaryLists);
 
     QFormLayout* formLay = new QFormLayout;
 
@@ -169,6 +173,7 @@ GtPreferencesApp::GtPreferencesApp() :
     m_lastOpenedProject->setChecked(settings->openLastProject());
     m_openWelcomePage->setChecked(settings->showStartupPage());
     m_updateAtStartup->setChecked(settings->searchForUpdate());
+    m_storeBinaryLists->setChecked(settings->storeBinaryLists());
 
     // process runner
     m_useExtendedProcessExecutor->setChecked(
@@ -202,6 +207,11 @@ GtPreferencesApp::saveSettings(GtSettings& settings) const
     settings.setShowStartupPage(m_openWelcomePage->isChecked());
     settings.setSearchForUpdate(m_updateAtStartup->isChecked());
 
+    // binary lists
+    settings.setStoreBinaryLists(m_storeBinaryLists->isChecked());
+    gt::xml::setBinaryListThreshold(m_storeBinaryLists->isChecked() ?
+                                    gt::xml::S_BINARY_LIST_THRESHOLD : 0);
+
     // log length
     settings.setMaxLogLength(m_maxLogSpin->value());
     GtLogModel::instance().setMaxLogLength(m_maxLogSpin->value());
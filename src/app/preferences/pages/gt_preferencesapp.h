@@ -65,6 +65,9 @@ private:
     /// Select the theme to use (by system, dark, bright)
     QComboBox* m_themeSelection;
 
+    /// Checkbox to store large lists binary
+    QCheckBox* m_storeBinaryLists;
+
 private slots:
     /**
      * @brief onAutoSaveTriggered
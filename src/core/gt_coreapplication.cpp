@@ -40,6 +40,7 @@
 #include "gt_algorithms.h"
 #include "gt_moduleinterface.h"
 #include "gt_taskgroup.h"
+#include "gt_xmlutilities.h"
 
 #include <gt_logdest.h>
 
@@ -164,6 +165,10 @@ GtCoreApplication::init()
     gtEnvironment->setRoamingDir(roamingPath());
     gtEnvironment->loadEnvironment();
 
+    // large lists are stored binary if enabled
+    gt::xml::setBinaryListThreshold(settings()->storeBinaryLists() ?
+                                    gt::xml::S_BINARY_LIST_THRESHOLD : 0);
+
     // forward project changed signals
     connect(this, &GtCoreApplication::currentProjectChanged,
             gtExternalizationManager, [](GtProject* project){
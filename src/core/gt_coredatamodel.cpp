@@ -510,7 +510,7 @@ GtCoreDatamodel::rowCount(const QModelIndex& parent) const
     }
 
     // return number of child objects
-    return parentItem->findDirectChildren<GtObject*>().size();
+    return parentItem->childObjects().size();
 }
 
 QModelIndex
@@ -549,17 +549,8 @@ GtCoreDatamodel::index(int row, int col, const QModelIndex& parent) const
         return {};
     }
 
-    QList<GtObject*> childItems =
-            parentItem->findDirectChildren<GtObject*>();
-
-    // check array size
-    if (row >= childItems.size())
-    {
-        return {};
-    }
-
     // get child object corresponding to row number
-    GtObject* childItem = childItems[row];
+    GtObject* childItem = parentItem->childObjects().value(row);
 
     // check object
     if (!childItem)
@@ -897,8 +888,9 @@ GtCoreDatamodel::appendChildren(QList<GtObject*> const& children,
 
     // TODO: check whether children can be appended or not before appending
 
-    beginInsertRows(parentIndex, parent->childCount<GtObject*>(),
-                    parent->childCount<GtObject*>() + children.size() - 1);
+    int const row = parent->childObjects().size();
+
+    beginInsertRows(parentIndex, row, row + children.size() - 1);
 
     if (!parent->appendChildren(children))
     {
@@ -19,6 +19,7 @@
 #include "gt_objectmemento.h"
 #include "gt_task.h"
 #include "gt_objectmementodiff.h"
+#include "gt_objectchangebatch.h"
 #include "gt_coreapplication.h"
 #include "gt_taskrunner.h"
 
@@ -37,6 +38,10 @@ struct GtCoreProcessExecutor::Impl
     /// (false = default behaviour for core)
     bool detached{false};
 
+    /// indicates whether only the source data linked by the task should be
+    /// transferred to the runnable
+    bool linkedDataOnly{false};
+
     /// custom project path for task execution
     QString customProjectPath;
 
@@ -62,6 +67,7 @@ GtCoreProcessExecutor::setCoreExecutorFlags(Flags flags)
 {
     pimpl->save     = !flags.testFlag(gt::DryExecution);
     pimpl->detached =  flags.testFlag(gt::NonBlockingExecution);
+    pimpl->linkedDataOnly = flags.testFlag(gt::LinkedSourceDataOnly);
 }
 
 bool
@@ -323,6 +329,9 @@ GtCoreProcessExecutor::handleTaskFinishedHelper(
 
     bool ok = true;
 
+    // the changed objects notify their observers once the merge is done
+    GtObjectChangeBatch batch;
+
     // source may be NULL if there are no object links defined in the
     // calculators included in the task
     if (m_source)
@@ -409,7 +418,7 @@ GtCoreProcessExecutor::clearCurrentTask()
 
         m_current->setState(state);
 
-        auto const pcs = m_current->findChildren<GtProcessComponent*>();
+        auto const pcs = m_current->findDescendants<GtProcessComponent*>();
 
         for (auto* pc : pcs)
         {
@@ -445,6 +454,7 @@ GtCoreProcessExecutor::setupTaskRunner()
 
     // create new task runner
     auto* runner = new GtTaskRunner{m_current};
+    runner->setLinkedSourceDataOnly(pimpl->linkedDataOnly);
 
     // create new runnable
     pimpl->currentRunnable = new GtRunnable{pimpl->customProjectPath};
@@ -39,7 +39,10 @@ enum CoreProcessExecutorFlag
     /// Do not save process results on successful execution
     DryExecution = 1,
     /// Whether a task run should be blocking or not
-    NonBlockingExecution = 2
+    NonBlockingExecution = 2,
+    /// Only transfer the source data linked by the task, other source data is
+    /// fetched on first access
+    LinkedSourceDataOnly = 4
 };
 
 }
@@ -54,8 +54,7 @@ GtExplorerModel::getPersistentIndexList()
 void
 GtExplorerModel::filterData(const QString& val)
 {
-    setFilterRegExp(val);
-    invalidate();
+    GtTreeFilterModel::filterData(val);
 }
 
 Qt::DropActions
@@ -74,7 +73,7 @@ GtExplorerModel::filterAcceptsRow(int source_row,
 
         if (obj)
         {
-            GtObjectList childs = obj->findDirectChildren<GtObject*>();
+            auto const& childs = obj->childObjects();
 
             if (childs.size() > source_row)
             {
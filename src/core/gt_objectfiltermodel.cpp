@@ -23,6 +23,7 @@ void
 GtObjectFilterModel::setFilterData(const QStringList& val)
 {
     m_filterData = val;
+    invalidateFilterIndex();
     invalidate();
 }
 
@@ -30,10 +31,16 @@ bool
 GtObjectFilterModel::filterAcceptsRow(int source_row,
                                       const QModelIndex& source_parent) const
 {
-    return GtTreeFilterModel::filterAcceptsRow(source_row, source_parent,
-        [this](const GtObject* obj) {
-          return acceptsRow(obj->metaObject()->className());
-    });
+    return filterAcceptsIndexedRow(source_row, source_parent);
+}
+
+bool
+GtObjectFilterModel::acceptsSourceIndex(const QModelIndex& source_index) const
+{
+    GtObject* obj = static_cast<GtObject*>(source_index.internalPointer());
+    assert(obj);
+
+    return acceptsRow(obj->metaObject()->className());
 }
 
 Qt::ItemFlags
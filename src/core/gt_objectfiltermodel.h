@@ -46,6 +46,13 @@ protected:
     bool filterAcceptsRow(int source_row,
                           const QModelIndex& source_parent) const override;
 
+    /**
+     * @brief Accepts objects of the classes of the filter data
+     * @param source_index
+     * @return
+     */
+    bool acceptsSourceIndex(const QModelIndex& source_index) const override;
+
     /**
      * @brief flags
      * @param index
@@ -10,8 +10,14 @@
 
 #include <QDomDocument>
 #include <QXmlStreamWriter>
+#include <QXmlStreamReader>
 #include <QDir>
 #include <QDateTime>
+#include <QCryptographicHash>
+#include <QMutex>
+#include <QThread>
+#include <QSet>
+#include <QtConcurrent>
 
 #include "gt_project.h"
 #include "gt_processdata.h"
@@ -35,11 +41,43 @@
 
 #include "internal/gt_moduleupgrader.h"
 #include "internal/gt_moduleupgrader.h"
+#include "internal/gt_modulesavestate.h"
 
 #include <cassert>
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+namespace
+{
+
+/// Returns the hash of the given file content
+QByteArray
+fileContentHash(QIODevice& device)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(&device);
+    return hash.result().toHex();
+}
+
+QByteArray
+fileContentHash(const QString& filePath)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return {};
+    }
+
+    return fileContentHash(file);
+}
+
+} // namespace
 
 GtProject::GtProject(const QString& path) :
     m_path(path),
+    m_saveState(std::make_unique<GtModuleSaveState>()),
     m_pathProp(QStringLiteral("path"), tr("Path"), tr("Project path"), path)
 {
     m_valid = loadMetaData();
@@ -49,6 +87,8 @@ GtProject::GtProject(const QString& path) :
 
     registerProperty(m_pathProp);
 
+    enableClassIndex();
+
     setProperty("tmp_ignoreIrregularities", false);
 }
 
@@ -117,6 +157,18 @@ GtProject::setInternalizeOnSave(bool value)
     m_internalizeOnSave = value;
 }
 
+void
+GtProject::setIncrementalSave(bool value)
+{
+    m_incrementalSave = value;
+}
+
+bool
+GtProject::incrementalSave() const
+{
+    return m_incrementalSave;
+}
+
 QStringList
 GtProject::availableModuleUpgrades() const
 {
@@ -400,6 +452,7 @@ void
 GtProject::readModuleMetaData(const QDomElement& root)
 {
     m_moduleIds.clear();
+    m_saveState->clear();
 
     /* module informations */
     QDomElement mdata = root.firstChildElement(QStringLiteral("MODULES"));
@@ -432,6 +485,17 @@ GtProject::readModuleMetaData(const QDomElement& root)
                                       << tr("Unknown module: ") << mid;
             }
             m_moduleIds << mid;
+
+            // the hash of the module file is only valid for the module
+            // version it was saved with
+            QString hash = module.attribute(QStringLiteral("hash"));
+
+            if (!hash.isEmpty() &&
+                module.attribute(QStringLiteral("version")) ==
+                gtApp->moduleVersion(mid).toString())
+            {
+                m_saveState->setFileHash(mid, hash.toLatin1());
+            }
         }
 
         module = module.nextSiblingElement(QStringLiteral("MODULE"));
@@ -509,16 +573,28 @@ GtProject::readLabelData(const GtObjectList& moduleData)
         }
     }
 
-    // read datamodel label entries
+    // read datamodel label entries. The module data is not part of the
+    // project yet, thus the label index cannot be used
+    QStringList labelIds;
+    QSet<QString> knownIds;
     foreach (GtObject* obj, moduleData)
     {
         QList<GtLabel*> labels = obj->findChildren<GtLabel*>();
         foreach (GtLabel* label, labels)
         {
-            data->addLabel(label->objectName());
+            if (!knownIds.contains(label->objectName()))
+            {
+                knownIds.insert(label->objectName());
+                labelIds.append(label->objectName());
+            }
         }
     }
 
+    foreach (const QString& id, labelIds)
+    {
+        data->addLabel(id);
+    }
+
     // add default label
     data->addDefaultLabel();
 
@@ -528,7 +604,8 @@ GtProject::readLabelData(const GtObjectList& moduleData)
 GtObjectList
 GtProject::readModuleData()
 {
-    GtObjectList retval;
+    QStringList mids;
+    QHash<QString, QString> packageIds;
 
     foreach (const QString& mid, m_moduleIds)
     {
@@ -546,90 +623,260 @@ GtProject::readModuleData()
             continue;
         }
 
-        // check for old module file and rename it
-        renameOldModuleFile(m_path, mid);
+        mids.append(mid);
+        packageIds.insert(mid, packageId);
+    }
+
+    // module files are independent of each other, hence the files of thread
+    // safe packages are read concurrently. The packages are moved to the
+    // calling thread.
+    QThread* thread = QThread::currentThread();
 
-        QString filename = m_path + QDir::separator() + mid.toLower() + "." +
-                           moduleExtension();
+    QStringList concurrentMids;
+    QStringList serialMids;
 
-        QFile file(filename);
+    for (const QString& mid : qAsConst(mids))
+    {
+        const QMetaObject* meta =
+            gtObjectFactory->metaObject(packageIds.value(mid));
 
-        if (!file.exists())
+        if (meta && GtPackage::isThreadSafe(*meta))
         {
-            gtWarning() << objectName() << ": "
-                      << tr("GTlab module file not found!") << "(" << mid
-                      << ")";
-            continue;
+            concurrentMids.append(mid);
+        }
+        else
+        {
+            serialMids.append(mid);
         }
+    }
 
-        QDomDocument document;
+    QMutex mutex;
+    QHash<QString, QByteArray> fileHashes;
 
-        QString errorStr;
-        int errorLine;
-        int errorColumn;
+    std::function<GtObject*(const QString&)> readModule =
+            [&](const QString& mid) {
+        QByteArray fileHash;
+        GtObject* obj = readModuleFile(mid, packageIds.value(mid), thread,
+                                       fileHash);
 
-        if (!gt::xml::readDomDocumentFromFile(file, document, true, &errorStr,
-                                              &errorLine, &errorColumn))
-        {
-            gtWarning() << tr("XML ERROR!") << " " << tr("line") << ": "
-                      << errorLine << " " << tr("column") << ": "
-                      << errorColumn << " -> " << errorStr;
-            continue;
-        }
+        QMutexLocker locker(&mutex);
+        fileHashes.insert(mid, fileHash);
 
-        QDomElement root = document.documentElement();
+        return obj;
+    };
 
-        if (root.isNull() || (root.tagName() != QLatin1String("GTLABMODULE")))
-        {
-            gtWarning() << tr("Invalid GTlab module file!");
-            continue;
-        }
+    QHash<QString, GtObject*> packages;
 
-        const QString uuid = root.attribute(QStringLiteral("uuid"));
+    GtObjectList concurrentPackages =
+        QtConcurrent::blockingMapped<GtObjectList>(concurrentMids,
+                                                   readModule);
 
-        if (uuid.isEmpty())
-        {
-            gtWarning() << tr("Invalid GTlab module file!");
-            continue;
-        }
+    for (int i = 0; i < concurrentMids.size(); ++i)
+    {
+        packages.insert(concurrentMids.at(i), concurrentPackages.at(i));
+    }
 
-        GtObject* obj = gtObjectFactory->newObject(packageId);
+    for (const QString& mid : qAsConst(serialMids))
+    {
+        packages.insert(mid, readModule(mid));
+    }
+
+    // the packages keep the order of the modules
+    GtObjectList retval;
 
-        if (!obj)
+    for (const QString& mid : qAsConst(mids))
+    {
+        if (GtObject* obj = packages.value(mid))
         {
-            gtWarning() << objectName() << ": "
-                        << tr("Failed to create module package!")
-                        << " (" << mid << ")";
-            continue;
+            retval.append(obj);
         }
+    }
 
-        GtPackage* package = qobject_cast<GtPackage*>(obj);
+    // only module files that were not modified since the last save are
+    // known to match their package
+    for (const QString& mid : qAsConst(mids))
+    {
+        GtObject* obj = packages.value(mid);
+        QByteArray fileHash = m_saveState->fileHash(mid);
 
-        if (!package)
+        if (obj && !fileHash.isEmpty() && fileHashes.value(mid) == fileHash)
         {
-            gtWarning() << objectName() << ": "
-                        << tr("Failed to create module package!")
-                        << " (" << mid << ")";
-            continue;
+            m_saveState->setSaved(mid, fileHash, *obj);
+        }
+        else
+        {
+            m_saveState->remove(mid);
         }
+    }
 
-        package->setUuid(uuid);
+    return retval;
+}
 
-        if (!package->readData(root) || !package->readMiscData(QDir(m_path)))
+GtObject*
+GtProject::readModuleFile(const QString& mid, const QString& packageId,
+                          QThread* thread, QByteArray& fileHash)
+{
+    // check for old module file and rename it
+    renameOldModuleFile(m_path, mid);
+
+    QString filename = m_path + QDir::separator() + mid.toLower() + "." +
+                       moduleExtension();
+
+    QFile file(filename);
+
+    if (!file.exists())
+    {
+        gtWarning() << objectName() << ": "
+                  << tr("GTlab module file not found!") << "(" << mid
+                  << ")";
+        return nullptr;
+    }
+
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        gtWarning() << tr("XML ERROR!") << " "
+                    << tr("could not open file! (%1)").arg(filename);
+        return nullptr;
+    }
+
+    fileHash = fileContentHash(file);
+    file.seek(0);
+
+    std::unique_ptr<GtObject> obj(gtObjectFactory->newObject(packageId));
+
+    if (!obj)
+    {
+        gtWarning() << objectName() << ": "
+                    << tr("Failed to create module package!")
+                    << " (" << mid << ")";
+        return nullptr;
+    }
+
+    GtPackage* package = qobject_cast<GtPackage*>(obj.get());
+
+    if (!package)
+    {
+        gtWarning() << objectName() << ": "
+                    << tr("Failed to create module package!")
+                    << " (" << mid << ")";
+        return nullptr;
+    }
+
+    bool success = package->usesDefaultDataFormat() ?
+                       readModuleStream(file, *package) :
+                       readModuleDocument(file, *package);
+
+    if (!success)
+    {
+        gtWarning() << objectName() << ": "
+                    << tr("Failed to read module data!")
+                    << " (" << mid << ")";
+        return nullptr;
+    }
+
+    if (!package->readMiscData(QDir(m_path)))
+    {
+        gtWarning() << objectName() << ": "
+                    << tr("Failed to read module data!")
+                    << " (" << mid << ")";
+        return nullptr;
+    }
+
+    // externalized object must be initialized. Only the objects of the
+    // package are flagged, hence this may be called from worker threads.
+    gtExternalizationManager->initExternalizedObjects(*package);
+
+    gt::moveToThread(*package, thread);
+
+    return obj.release();
+}
+
+bool
+GtProject::readModuleStream(QFile& file, GtPackage& package)
+{
+    // the module file is parsed while the objects are created
+    QXmlStreamReader reader(&file);
+
+    auto xmlError = [&reader]() {
+        gtWarning() << tr("XML ERROR!") << " " << tr("line") << ": "
+                    << reader.lineNumber() << " " << tr("column") << ": "
+                    << reader.columnNumber() << " -> "
+                    << reader.errorString();
+    };
+
+    if (!reader.readNextStartElement())
+    {
+        xmlError();
+        return false;
+    }
+
+    if (reader.name() != QLatin1String("GTLABMODULE"))
+    {
+        gtWarning() << tr("Invalid GTlab module file!");
+        return false;
+    }
+
+    const QString uuid =
+        reader.attributes().value(QStringLiteral("uuid")).toString();
+
+    if (uuid.isEmpty())
+    {
+        gtWarning() << tr("Invalid GTlab module file!");
+        return false;
+    }
+
+    package.setUuid(uuid);
+
+    if (!package.readDataFromStream(reader))
+    {
+        if (reader.hasError())
         {
-            gtWarning() << objectName() << ": "
-                        << tr("Failed to read module data!")
-                        << " (" << mid << ")";
-            continue;
+            xmlError();
         }
 
-        // externalized object must be initialized
-        gtExternalizationManager->initExternalizedObjects(*package);
+        return false;
+    }
 
-        retval.append(obj);
+    return true;
+}
+
+bool
+GtProject::readModuleDocument(QFile& file, GtPackage& package)
+{
+    QDomDocument document;
+
+    QString errorStr;
+    int errorLine;
+    int errorColumn;
+
+    if (!document.setContent(&file, true, &errorStr, &errorLine,
+                             &errorColumn))
+    {
+        gtWarning() << tr("XML ERROR!") << " " << tr("line") << ": "
+                  << errorLine << " " << tr("column") << ": "
+                  << errorColumn << " -> " << errorStr;
+        return false;
     }
 
-    return retval;
+    QDomElement root = document.documentElement();
+
+    if (root.isNull() || (root.tagName() != QLatin1String("GTLABMODULE")))
+    {
+        gtWarning() << tr("Invalid GTlab module file!");
+        return false;
+    }
+
+    const QString uuid = root.attribute(QStringLiteral("uuid"));
+
+    if (uuid.isEmpty())
+    {
+        gtWarning() << tr("Invalid GTlab module file!");
+        return false;
+    }
+
+    package.setUuid(uuid);
+
+    return package.readData(root);
 }
 
 bool
@@ -647,12 +894,11 @@ GtProject::saveModuleData()
         // saving may continue
     }
 
+    QStringList mids;
+    QHash<QString, GtPackage*> packages;
+
     foreach (const QString& mid, m_moduleIds)
     {
-        gtDebug().noquote() << tr("saving module data")
-                           << QStringLiteral("\"") + mid +
-                              QStringLiteral("\" ...");
-
         GtPackage* package = findPackage(mid);
 
         if (!package)
@@ -660,43 +906,167 @@ GtProject::saveModuleData()
             gtWarning().noquote()
                     << tr("Failed to save module data!")
                     << QStringLiteral("(\"") + mid + QStringLiteral("\")");
+            m_saveState->remove(mid);
             continue;
         }
 
-        QDomDocument document;
-        QDomProcessingInstruction header = document.createProcessingInstruction(
-                QStringLiteral("xml"),
-                QStringLiteral("version=\"1.0\" encoding=\"utf-8\""));
-        document.appendChild(header);
+        if (!moduleNeedsSaving(mid, *package))
+        {
+            gtDebug().noquote() << tr("module data unchanged")
+                               << QStringLiteral("\"") + mid +
+                                  QStringLiteral("\"");
 
-        QDomElement rootElement =
-                document.createElement(QStringLiteral("GTLABMODULE"));
+            // additional data is not part of the module file
+            if (!package->saveMiscData(QDir(m_path)))
+            {
+                gtWarning().noquote()
+                        << tr("Failed to save module data!")
+                        << QStringLiteral("(\"") + mid + QStringLiteral("\")");
+            }
+            continue;
+        }
+
+        mids.append(mid);
+        packages.insert(mid, package);
+    }
 
-        rootElement.setAttribute(QStringLiteral("uuid"), package->uuid());
+    // packages are independent of each other, hence thread safe packages
+    // are serialized concurrently into their temporary files
+    std::function<QByteArray(const QString&)> saveModule =
+            [this, &packages](const QString& mid) {
+        return saveModuleFile(mid, *packages.value(mid));
+    };
 
-        document.appendChild(rootElement);
+    QStringList concurrentMids;
+    QStringList serialMids;
 
-        if (!package->saveData(rootElement, document) || !package->saveMiscData(QDir(m_path)))
+    for (const QString& mid : qAsConst(mids))
+    {
+        if (packages.value(mid)->isThreadSafe())
+        {
+            concurrentMids.append(mid);
+        }
+        else
+        {
+            serialMids.append(mid);
+        }
+    }
+
+    QHash<QString, QByteArray> hashes;
+
+    QList<QByteArray> concurrentHashes =
+        QtConcurrent::blockingMapped<QList<QByteArray>>(concurrentMids,
+                                                        saveModule);
+
+    for (int i = 0; i < concurrentMids.size(); ++i)
+    {
+        hashes.insert(concurrentMids.at(i), concurrentHashes.at(i));
+    }
+
+    for (const QString& mid : qAsConst(serialMids))
+    {
+        hashes.insert(mid, saveModule(mid));
+    }
+
+    // the new files are activated once all packages are written
+    for (const QString& mid : qAsConst(mids))
+    {
+        // the file of a failed module must be written again on next save
+        m_saveState->remove(mid);
+
+        const QByteArray hash = hashes.value(mid);
+
+        if (hash.isEmpty())
         {
-            gtWarning().noquote()
-                    << tr("Failed to save module data!")
-                    << QStringLiteral("(\"") + mid + QStringLiteral("\")");
             continue;
         }
 
-        QString filename = m_path + QDir::separator() + mid.toLower() + "." +
-                           moduleExtension();
+        QString filename = m_path + QDir::separator() + mid.toLower() +
+                           "." + moduleExtension();
 
-        if (!saveProjectFiles(filename, document))
+        if (!activateNewProjectFile(filename))
         {
             gtWarning() << "\t |->" << mid;
             continue;
         }
+
+        m_saveState->setSaved(mid, hash, *packages.value(mid));
     }
 
     return true;
 }
 
+bool
+GtProject::moduleNeedsSaving(const QString& mid,
+                             const GtPackage& package) const
+{
+    if (!m_incrementalSave || m_saveState->fileHash(mid).isEmpty())
+    {
+        return true;
+    }
+
+    // the module file of a custom data format may contain data that is not
+    // part of the package objects
+    if (!package.usesDefaultDataFormat())
+    {
+        return true;
+    }
+
+    QString filename = m_path + QDir::separator() + mid.toLower() + "." +
+                       moduleExtension();
+
+    if (!QFile::exists(filename))
+    {
+        return true;
+    }
+
+    // externalized objects may change their data silently when saving
+    if (!package.findDescendants<GtExternalizedObject*>().isEmpty())
+    {
+        return true;
+    }
+
+    return m_saveState->needsSaving(mid, package);
+}
+
+QByteArray
+GtProject::saveModuleFile(const QString& mid, GtPackage& package)
+{
+    gtDebug().noquote() << tr("saving module data")
+                       << QStringLiteral("\"") + mid +
+                          QStringLiteral("\" ...");
+
+    QString filename = m_path + QDir::separator() + mid.toLower() + "." +
+                       moduleExtension();
+
+    const QString tempFilePath = filename + QStringLiteral("_new");
+
+    // objects are written directly into the file
+    auto writeModule = [&package](QXmlStreamWriter& w) {
+        w.writeStartElement(QStringLiteral("GTLABMODULE"));
+
+        if (!package.saveDataToStream(w))
+        {
+            return false;
+        }
+
+        w.writeEndElement();
+        return true;
+    };
+
+    if (!gt::xml::writeStreamDocumentToFile(tempFilePath, writeModule) ||
+        !package.saveMiscData(QDir(m_path)))
+    {
+        gtWarning().noquote()
+                << tr("Failed to save module data!")
+                << QStringLiteral("(\"") + mid + QStringLiteral("\")");
+        QFile::remove(tempFilePath);
+        return {};
+    }
+
+    return fileContentHash(tempFilePath);
+}
+
 bool
 GtProject::saveProjectOverallData()
 {
@@ -759,7 +1129,7 @@ bool
 GtProject::saveExternalizedObjectData()
 {
     bool success{true};
-    auto objects = findChildren<GtExternalizedObject*>();
+    auto objects = findDescendants<GtExternalizedObject*>();
 
     // force internalization of all objects
     if (m_internalizeOnSave)
@@ -810,6 +1180,14 @@ GtProject::saveModuleMetaData(QDomElement& root, QDomDocument& doc)
         moduleElement.setAttribute(QStringLiteral("name"), mid);
         moduleElement.setAttribute(QStringLiteral("version"),
                                    gtApp->moduleVersion(mid).toString());
+
+        QByteArray fileHash = m_saveState->fileHash(mid);
+
+        if (!fileHash.isEmpty())
+        {
+            moduleElement.setAttribute(QStringLiteral("hash"),
+                                       QString::fromLatin1(fileHash));
+        }
         modulesElement.appendChild(moduleElement);
     }
 
@@ -900,33 +1278,6 @@ GtProject::readProjectData(const QDir& projectPath)
     return document;
 }
 
-QList<GtLabel*>
-GtProject::findLabelUsagesHelper(GtObject* obj, GtLabel* label)
-{
-    QList<GtLabel*> retval;
-
-    QList<GtObject*> childs = obj->findDirectChildren<GtObject*>();
-
-    foreach (GtObject* c, childs)
-    {
-        GtLabel* l = qobject_cast<GtLabel*>(c);
-
-        if (l)
-        {
-            if (l->objectName() == label->objectName())
-            {
-                retval.append(l);
-            }
-        }
-        else
-        {
-            retval.append(findLabelUsagesHelper(c, label));
-        }
-    }
-
-    return retval;
-}
-
 void
 GtProject::renameOldModuleFile(const QString& path, const QString& modId)
 {
@@ -960,6 +1311,21 @@ GtProject::saveProjectFiles(const QString& filePath, const QDomDocument& doc)
         return false;
     }
 
+    // keep the project file and its backup if nothing changed
+    if (m_incrementalSave && QFile::exists(filePath) &&
+        fileContentHash(tempFilePath) == fileContentHash(filePath))
+    {
+        return QFile::remove(tempFilePath);
+    }
+
+    return activateNewProjectFile(filePath);
+}
+
+bool
+GtProject::activateNewProjectFile(const QString& filePath)
+{
+    const QString tempFilePath = filePath + QStringLiteral("_new");
+
     //rename files
     /// => existing from 'path' to 'path + _backup'
     /// => the new file from 'path + _new' to 'path'
@@ -1238,9 +1604,10 @@ GtProject::findLabelUsages(GtLabel* label)
 
     QList<GtPackage*> packages = findDirectChildren<GtPackage*>();
 
+    // labels are looked up in the label index of the project
     foreach (GtPackage* package, packages)
     {
-        usages.append(findLabelUsagesHelper(package, label));
+        usages.append(package->findLabels(label->objectName()));
     }
 
     return usages;
@@ -15,6 +15,8 @@
 
 #include <QStringList>
 
+#include <memory>
+
 #include "gt_object.h"
 #include "gt_session.h"
 #include "gt_stringproperty.h"
@@ -22,6 +24,8 @@
 
 class QDomDocument;
 class QXmlStreamWriter;
+class QThread;
+class QFile;
 class QDomElement;
 class GtProcessData;
 class GtTask;
@@ -30,6 +34,7 @@ class GtPackage;
 class GtLabelData;
 class GtLabel;
 class GtVersionNumber;
+class GtModuleSaveState;
 
 /**
  * @brief The GtProject class
@@ -202,6 +207,21 @@ public:
      */
     void setInternalizeOnSave(bool value);
 
+    /**
+     * @brief Sets whether only changed modules should be saved. Module files
+     * of packages without changes since the last save or load are neither
+     * rewritten nor backed up. Only packages using the default data format
+     * are skipped, their misc data is saved anyway. Enabled by default.
+     * @param value true if only changed modules should be saved
+     */
+    void setIncrementalSave(bool value);
+
+    /**
+     * @brief Returns whether only changed modules are saved
+     * @return true if incremental saving is enabled
+     */
+    bool incrementalSave() const;
+
     /**
      * @brief eturns the identification strings of all modules for which at
      * least one upgrade is available.
@@ -307,6 +327,13 @@ private:
     /// Whether to internalize all external data when saving
     bool m_internalizeOnSave{false};
 
+    /// Whether to skip unchanged modules when saving
+    bool m_incrementalSave{true};
+
+    /// Module files that match the module data. The hashes of the files
+    /// are stored in the project file.
+    std::unique_ptr<GtModuleSaveState> m_saveState;
+
     /// List of all project module ids
     QStringList m_moduleIds;
 
@@ -353,12 +380,63 @@ private:
      */
     GtObjectList readModuleData();
 
+    /**
+     * @brief Reads the module file of the given module. May be called
+     * concurrently for different modules of thread safe packages.
+     * @param mid Module identification string
+     * @param packageId Class name of the module package
+     * @param thread Thread the package is moved to
+     * @param fileHash Hash of the module file content
+     * @return Module package or nullptr if the file could not be read
+     */
+    GtObject* readModuleFile(const QString& mid, const QString& packageId,
+                             QThread* thread, QByteArray& fileHash);
+
+    /**
+     * @brief Reads the module file of a package using the default data
+     * format. The objects are created while parsing the file.
+     * @param file Opened module file
+     * @param package Module package
+     * @return true if the module data was read successfully
+     */
+    bool readModuleStream(QFile& file, GtPackage& package);
+
+    /**
+     * @brief Reads the whole module file into a dom document, which is
+     * passed to the readData implementation of the package.
+     * @param file Opened module file
+     * @param package Module package
+     * @return true if the module data was read successfully
+     */
+    bool readModuleDocument(QFile& file, GtPackage& package);
+
     /**
      * @brief saveModuleData
      * @return success
      */
     bool saveModuleData();
 
+    /**
+     * @brief Writes the package data of the given module into the temporary
+     * module file ('_new'). May be called concurrently for different
+     * modules of thread safe packages.
+     * @param mid Module identification string
+     * @param package Module package
+     * @return Hash of the written file. Empty if saving failed.
+     */
+    QByteArray saveModuleFile(const QString& mid, GtPackage& package);
+
+    /**
+     * @brief Checks whether the module file of the given package has to be
+     * written. Files of packages using the default data format whose data
+     * equals the data that was last saved into or loaded from the file are
+     * kept.
+     * @param mid Module identification string
+     * @param package Module package
+     * @return true if the module file has to be written
+     */
+    bool moduleNeedsSaving(const QString& mid, const GtPackage& package) const;
+
     /**
      * @brief saveProjectOverallData
      * @return success
@@ -402,14 +480,6 @@ private:
      */
     static QDomDocument readProjectData(const QDir& projectPath);
 
-    /**
-     * @brief findLabelUsagesHelper
-     * @param obj
-     * @param label
-     * @return
-     */
-    static QList<GtLabel*> findLabelUsagesHelper(GtObject* obj, GtLabel* label);
-
     /**
      * @brief renameOldModuleFile
      * @param path
@@ -425,6 +495,14 @@ private:
      */
     bool saveProjectFiles(const QString& filePath, const QDomDocument& doc);
 
+    /**
+     * @brief Replaces the project file by the previously written file
+     * 'filePath + _new'. The old state is kept as 'filePath + _backup'.
+     * @param filePath : file path
+     * @return success
+     */
+    bool activateNewProjectFile(const QString& filePath);
+
     /**
      * @brief Updates module footprint version stored in project file.
      * New version matches the current module version of the framework.
@@ -51,7 +51,7 @@ GtRunnable::run()
         gtError() << "Calculator execution failed!";
         success = false;
 
-        auto const tasks = pc->findChildren<GtTask*>();
+        auto const tasks = pc->findDescendants<GtTask*>();
 
         for (GtTask* task : tasks)
         {
@@ -102,7 +102,7 @@ GtRunnable::requestInterruption()
             tasks << task;
         }
 
-        tasks.append(calc->findChildren<GtTask*>());
+        tasks.append(calc->findDescendants<GtTask*>());
     }
 
     foreach (GtTask* task, tasks)
@@ -148,16 +148,27 @@ GtRunnable::readObjects()
 
         if (obj)
         {
+            obj->enableUuidIndex();
             m_linkedObjects.append(obj);
         }
     }
+
+    initPartialObjects();
 }
 
 void
 GtRunnable::writeObjects()
 {
-    for (GtObject* obj : qAsConst(m_linkedObjects))
+    auto const objects = outputObjects();
+
+    for (GtObject* obj : objects)
     {
-        m_outputData << GtObjectMemento(obj);
+        GtObjectMemento memento(obj);
+
+        // hashes are needed to merge the data, calculate them in the
+        // worker thread
+        memento.calculateHashes();
+
+        m_outputData << std::move(memento);
     }
 }
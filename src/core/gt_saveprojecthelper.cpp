@@ -31,12 +31,14 @@ GtSaveProjectHelper::run()
         return;
     }
 
-    if (!m_project->saveProjectOverallData())
+    // module data is saved first, since the project file stores the hashes
+    // of the module files
+    if (!m_project->saveModuleData())
     {
         return;
     }
 
-    if (!m_project->saveModuleData())
+    if (!m_project->saveProjectOverallData())
     {
         return;
     }
@@ -22,6 +22,7 @@ GtSession::GtSession(const QString& id, QString sessionPath) :
     m_currentProject(nullptr)
 {
     setObjectName(id);
+    enableClassIndex();
 
     if (sessionPath.isEmpty())
     {
@@ -38,7 +39,7 @@ GtSession::GtSession(const QString& id, QString sessionPath) :
 
 GtSession::GtSession() : m_valid(false)
 {
-
+    enableClassIndex();
 }
 
 GtObjectList
@@ -77,12 +78,14 @@ GtSession::saveProjectData(GtProject* project)
         return false;
     }
 
-    if (!project->saveProjectOverallData())
+    // module data is saved first, since the project file stores the hashes
+    // of the module files
+    if (!project->saveModuleData())
     {
         return false;
     }
 
-    if (!project->saveModuleData())
+    if (!project->saveProjectOverallData())
     {
         return false;
     }
@@ -10,15 +10,463 @@
 
 #include "gt_treefiltermodel.h"
 
+#include <QFutureWatcher>
+#include <QHash>
+#include <QPair>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace
+{
+
+/// Number of items above which filterData filters in a background thread
+constexpr int S_ASYNC_THRESHOLD = 20000;
+
+/// Flat copy of the source tree
+struct TreeSnapshot
+{
+    /// item numbers by the internal id and row of their source index
+    QHash<QPair<quintptr, int>, int> items;
+
+    /// parent item of each item (-1 for top level items)
+    QVector<int> parents;
+
+    /// filter key of each item
+    QVector<QString> keys;
+
+    /// result of acceptsSourceIndex of each item
+    QVector<bool> candidates;
+};
+
+/// Items matching a filter
+struct FilterResult
+{
+    QRegExp regExp;
+
+    /// items matching the filter
+    QVector<int> matches;
+
+    /// items matching the filter and their ancestors
+    QVector<bool> accepted;
+};
+
+/// Returns whether the pattern matches the text literally
+bool
+isLiteral(const QRegExp& regExp)
+{
+    switch (regExp.patternSyntax())
+    {
+    case QRegExp::FixedString:
+        return true;
+    case QRegExp::RegExp:
+    case QRegExp::RegExp2:
+        return QRegExp::escape(regExp.pattern()) == regExp.pattern();
+    default:
+        return false;
+    }
+}
+
+/// Returns whether all texts matching `next` also match `previous`
+bool
+isRefinement(const QRegExp& previous, const QRegExp& next)
+{
+    return previous.caseSensitivity() == next.caseSensitivity() &&
+           isLiteral(previous) && isLiteral(next) &&
+           next.pattern().contains(previous.pattern(),
+                                   next.caseSensitivity());
+}
+
+/**
+ * @brief Determines the items of the tree matching the filter
+ * @param tree Source tree
+ * @param regExp Filter
+ * @param previous Previous result. Only its matches are tested if the
+ * filter refines the previous filter. May be null
+ * @return Filter result
+ */
+FilterResult
+filterTree(const TreeSnapshot& tree, const QRegExp& regExp,
+           const FilterResult* previous)
+{
+    FilterResult result;
+    result.regExp = regExp;
+
+    // QString::contains copies the regular expression on each call
+    QRegExp rx(regExp);
+
+    auto test = [&](int i) {
+        if (tree.candidates[i] && rx.indexIn(tree.keys[i]) != -1)
+        {
+            result.matches.append(i);
+        }
+    };
+
+    if (previous && isRefinement(previous->regExp, regExp))
+    {
+        for (int i : previous->matches) test(i);
+    }
+    else
+    {
+        for (int i = 0; i < tree.keys.size(); ++i) test(i);
+    }
+
+    result.accepted.fill(false, tree.keys.size());
+
+    for (int i : qAsConst(result.matches))
+    {
+        for (int j = i; j >= 0 && !result.accepted[j]; j = tree.parents[j])
+        {
+            result.accepted[j] = true;
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+struct GtTreeFilterModel::Impl
+{
+    /// flat copy of the source tree
+    TreeSnapshot tree;
+
+    /// whether the tree is up to date
+    bool treeValid{false};
+
+    /// incremented whenever the tree is rebuilt
+    int treeRevision{0};
+
+    /// result of the current filter
+    FilterResult result;
+
+    /// whether the result belongs to the tree
+    bool resultValid{false};
+
+    /// filter evaluated in a background thread
+    QFutureWatcher<FilterResult> watcher;
+
+    /// tree revision and request of the running evaluation
+    int runningRevision{0};
+    int runningRequest{0};
+
+    /// filter to evaluate once the running evaluation is finished
+    QString pendingFilter;
+    bool hasPendingFilter{false};
+
+    /// number of filter requests
+    int requests{0};
+
+    /// connections to the source model
+    QList<QMetaObject::Connection> connections;
+
+    /// source index of the root item, only its descendants are filtered
+    QPersistentModelIndex root;
+
+    void buildTree(const GtTreeFilterModel& model)
+    {
+        tree = TreeSnapshot{};
+        treeValid = true;
+        treeRevision++;
+        resultValid = false;
+
+        if (model.sourceModel())
+        {
+            addItems(model, root, -1);
+        }
+    }
+
+    /// discards the tree, e.g. once the filter is cleared
+    void clearTree()
+    {
+        tree = TreeSnapshot{};
+        treeValid = false;
+        resultValid = false;
+    }
+
+    /**
+     * @brief Updates the keys of the changed items in place. The tree is
+     * rebuilt if an item is not found.
+     * @param model Filter model
+     * @param topLeft First changed index of the source model
+     * @param bottomRight Last changed index of the source model
+     */
+    void updateItems(const GtTreeFilterModel& model,
+                     const QModelIndex& topLeft,
+                     const QModelIndex& bottomRight)
+    {
+        int const column = std::max(0, model.filterKeyColumn());
+
+        if (!treeValid || column < topLeft.column() ||
+            column > bottomRight.column())
+        {
+            return;
+        }
+
+        QAbstractItemModel const& source = *model.sourceModel();
+
+        for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+        {
+            QModelIndex index = source.index(row, column, topLeft.parent());
+            if (!index.isValid()) continue;
+
+            auto iter = tree.items.constFind(
+                        qMakePair(index.internalId(), row));
+
+            if (iter == tree.items.constEnd())
+            {
+                // items outside of the root are not part of the tree
+                if (isBelowRoot(index)) treeValid = false;
+                continue;
+            }
+
+            tree.keys[*iter] = source.data(index, model.filterRole())
+                               .toString();
+            tree.candidates[*iter] = model.acceptsSourceIndex(index);
+            resultValid = false;
+        }
+    }
+
+    /// returns whether the index is a descendant of the root
+    bool isBelowRoot(QModelIndex index) const
+    {
+        if (!root.isValid()) return true;
+
+        while ((index = index.parent()).isValid())
+        {
+            if (isSameItem(index, root)) return true;
+        }
+        return false;
+    }
+
+    /// returns whether the index is the root or one of its ancestors
+    bool isRootOrAncestor(const QModelIndex& index) const
+    {
+        for (QModelIndex i = root; i.isValid(); i = i.parent())
+        {
+            if (isSameItem(i, index)) return true;
+        }
+        return false;
+    }
+
+    /// returns whether the indices refer to the same item ignoring columns
+    static bool isSameItem(const QModelIndex& a, const QModelIndex& b)
+    {
+        return a.row() == b.row() && a.internalId() == b.internalId() &&
+               a.model() == b.model();
+    }
+
+    /**
+     * @brief Searches the subtree of the index for an item fulfilling
+     * acceptsSourceIndex and matching the filter. Used instead of the tree
+     * while the filter is empty.
+     * @param model Filter model
+     * @param index Source index
+     * @return Whether the item or one of its descendants matches
+     */
+    static bool acceptsRecursively(const GtTreeFilterModel& model,
+                                   const QModelIndex& index)
+    {
+        QAbstractItemModel const& source = *model.sourceModel();
+
+        if (model.acceptsSourceIndex(index) &&
+            source.data(index, model.filterRole()).toString()
+                .contains(model.filterRegExp()))
+        {
+            return true;
+        }
+
+        for (int row = 0; row < source.rowCount(index); ++row)
+        {
+            QModelIndex child = source.index(row, index.column(), index);
+            if (child.isValid() && acceptsRecursively(model, child))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void addItems(const GtTreeFilterModel& model,
+                  const QModelIndex& parent, int parentItem)
+    {
+        QAbstractItemModel const& source = *model.sourceModel();
+        int const column = std::max(0, model.filterKeyColumn());
+
+        int const rows = source.rowCount(parent);
+        for (int row = 0; row < rows; ++row)
+        {
+            QModelIndex index = source.index(row, column, parent);
+            if (!index.isValid()) continue;
+
+            int const item = tree.keys.size();
+
+            tree.items.insert(qMakePair(index.internalId(), row), item);
+            tree.parents.append(parentItem);
+            tree.keys.append(source.data(index, model.filterRole())
+                             .toString());
+            tree.candidates.append(model.acceptsSourceIndex(index));
+
+            addItems(model, index, item);
+        }
+    }
+
+    /// updates the tree and the result of the current filter
+    void update(const GtTreeFilterModel& model)
+    {
+        if (!treeValid)
+        {
+            buildTree(model);
+        }
+
+        QRegExp const regExp = model.filterRegExp();
+
+        if (!resultValid || !(result.regExp == regExp))
+        {
+            result = filterTree(tree, regExp, resultValid ? &result : nullptr);
+            resultValid = true;
+        }
+    }
+
+    /// starts evaluating the pending filter in a background thread
+    void startPendingFilter(const GtTreeFilterModel& model)
+    {
+        hasPendingFilter = false;
+
+        QRegExp regExp = model.filterRegExp();
+        regExp.setPattern(pendingFilter);
+
+        runningRevision = treeRevision;
+        runningRequest = requests;
+
+        bool const hasPrevious = resultValid;
+        watcher.setFuture(QtConcurrent::run(
+            [tree = tree, regExp, previous = result, hasPrevious]() {
+            return filterTree(tree, regExp, hasPrevious ? &previous : nullptr);
+        }));
+    }
+};
+
 GtTreeFilterModel::GtTreeFilterModel(QObject* parent) :
-    QSortFilterProxyModel(parent)
+    QSortFilterProxyModel(parent),
+    pimpl(std::make_unique<Impl>())
 {
     setFilterCaseSensitivity(Qt::CaseInsensitive);
+
+    connect(&pimpl->watcher, &QFutureWatcher<FilterResult>::finished,
+            this, [this]() {
+        Impl& d = *pimpl;
+
+        FilterResult result = d.watcher.result();
+
+        // result is outdated if the tree has changed meanwhile
+        bool const isValid = d.treeValid &&
+                             d.runningRevision == d.treeRevision;
+        if (isValid)
+        {
+            d.result = std::move(result);
+            d.resultValid = true;
+        }
+
+        if (d.hasPendingFilter && isValid)
+        {
+            d.startPendingFilter(*this);
+            return;
+        }
+
+        // apply the filter unless a newer one has been set directly
+        if (d.runningRequest == d.requests || d.hasPendingFilter)
+        {
+            d.hasPendingFilter = false;
+            setFilterRegExp(isValid ? d.result.regExp.pattern() :
+                                      d.pendingFilter);
+        }
+    });
+}
+
+GtTreeFilterModel::~GtTreeFilterModel() = default;
+
+void
+GtTreeFilterModel::setRootIndex(const QModelIndex& index)
+{
+    QModelIndex source = index.model() == this ? mapToSource(index) : index;
+
+    if (pimpl->root == source) return;
+
+    pimpl->root = source;
+    pimpl->clearTree();
+
+    invalidateFilter();
+}
+
+void
+GtTreeFilterModel::setSourceModel(QAbstractItemModel* sourceModel)
+{
+    for (auto const& connection : qAsConst(pimpl->connections))
+    {
+        disconnect(connection);
+    }
+    pimpl->connections.clear();
+    pimpl->clearTree();
+    pimpl->root = QPersistentModelIndex();
+
+    // connected before the proxy model handles the changes
+    if (sourceModel)
+    {
+        auto invalidateTree = [this]() { pimpl->treeValid = false; };
+
+        pimpl->connections
+            << connect(sourceModel, &QAbstractItemModel::rowsInserted,
+                       this, invalidateTree)
+            << connect(sourceModel, &QAbstractItemModel::rowsRemoved,
+                       this, invalidateTree)
+            << connect(sourceModel, &QAbstractItemModel::rowsMoved,
+                       this, invalidateTree)
+            << connect(sourceModel, &QAbstractItemModel::layoutChanged,
+                       this, invalidateTree)
+            << connect(sourceModel, &QAbstractItemModel::modelReset,
+                       this, invalidateTree)
+            << connect(sourceModel, &QAbstractItemModel::dataChanged,
+                       this, [this](const QModelIndex& topLeft,
+                                    const QModelIndex& bottomRight,
+                                    const QVector<int>& roles) {
+            if (roles.isEmpty() || roles.contains(filterRole()) ||
+                roles.contains(Qt::DisplayRole))
+            {
+                pimpl->updateItems(*this, topLeft, bottomRight);
+            }
+        });
+    }
+
+    QSortFilterProxyModel::setSourceModel(sourceModel);
 }
 
 void
 GtTreeFilterModel::filterData(const QString& val)
 {
+    Impl& d = *pimpl;
+    d.requests++;
+
+    if (!val.isEmpty() && sourceModel())
+    {
+        if (!d.treeValid) d.buildTree(*this);
+
+        if (d.tree.keys.size() >= S_ASYNC_THRESHOLD)
+        {
+            d.pendingFilter = val;
+            d.hasPendingFilter = true;
+
+            if (!d.watcher.isRunning()) d.startPendingFilter(*this);
+            return;
+        }
+    }
+
+    d.hasPendingFilter = false;
+
+    // the tree is only kept while filtering
+    if (val.isEmpty()) d.clearTree();
+
     setFilterRegExp(val);
     invalidate();
 }
@@ -32,8 +480,50 @@ GtTreeFilterModel::filterAcceptsRow(int source_row,
         return QSortFilterProxyModel::filterAcceptsRow(source_row, source_parent);
     }
 
-    return filterAcceptsRow(source_row, source_parent, [](const GtObject*)
+    return filterAcceptsIndexedRow(source_row, source_parent);
+}
+
+bool
+GtTreeFilterModel::filterAcceptsIndexedRow(int source_row,
+                                           const QModelIndex& source_parent) const
+{
+    QModelIndex source_index =
+        sourceModel()->index(source_row, std::max(0, filterKeyColumn()),
+                             source_parent);
+
+    if (!source_index.isValid()) return false;
+
+    Impl& d = *pimpl;
+
+    // the root and its ancestors are always accepted, other items outside
+    // of the root are rejected
+    bool const isBelowRoot = d.isBelowRoot(source_index);
+    if (!isBelowRoot)
+    {
+        return d.isRootOrAncestor(source_index);
+    }
+
+    if (filterRegExp().isEmpty())
     {
-        return true;
-    });
+        return Impl::acceptsRecursively(*this, source_index);
+    }
+
+    d.update(*this);
+
+    auto iter = d.tree.items.constFind(
+                qMakePair(source_index.internalId(), source_row));
+
+    return iter != d.tree.items.constEnd() && d.result.accepted[*iter];
+}
+
+bool
+GtTreeFilterModel::acceptsSourceIndex(const QModelIndex&) const
+{
+    return true;
+}
+
+void
+GtTreeFilterModel::invalidateFilterIndex()
+{
+    pimpl->treeValid = false;
 }
@@ -16,8 +16,17 @@
 #include <QSortFilterProxyModel>
 #include <gt_object.h>
 
+#include <memory>
+
 /**
  * @brief The GtTreeFilterModel class
+ * Accepts the items matching the filter and their ancestors. The matching
+ * items are determined in a single pass over a flat copy of the source tree
+ * below the root index (filter index), which is only kept while a filter is
+ * set. Changed items are updated in place, inserting, moving or removing
+ * items rebuilds the copy. Items are looked up in the result instead of
+ * searching their subtree. If the filter is refined (e.g. while typing),
+ * only the previous matches are tested.
  */
 class GT_CORE_EXPORT GtTreeFilterModel : public QSortFilterProxyModel
 {
@@ -26,11 +35,23 @@ class GT_CORE_EXPORT GtTreeFilterModel : public QSortFilterProxyModel
 public:
     explicit GtTreeFilterModel(QObject* parent = nullptr);
 
+    ~GtTreeFilterModel() override;
+
+    /**
+     * @brief Sets the root index. Only the descendants of the root are
+     * filtered, while the root and its ancestors are always accepted and
+     * other items are rejected (see filterAcceptsIndexedRow).
+     * @param index Index of the source model or of this model. An invalid
+     * index filters the whole source model
+     */
     void setRootIndex(const QModelIndex& index);
 
+    void setSourceModel(QAbstractItemModel* sourceModel) override;
+
 public slots:
     /**
-     * @brief filterData
+     * @brief Sets the filter. Large trees are filtered in a background
+     * thread, the previous result is shown until the new one is available.
      * @param val
      */
     void filterData(const QString& val);
@@ -45,9 +66,37 @@ protected:
     bool filterAcceptsRow(int source_row,
                           const QModelIndex& source_parent) const override;
 
+    /**
+     * @brief Looks up the row in the filter index. In contrast to
+     * filterAcceptsRow, items not fulfilling acceptsSourceIndex are rejected
+     * even if the filter is empty. In this case, the subtree of the row is
+     * searched instead of using the filter index.
+     * @param source_row
+     * @param source_parent
+     * @return Whether the row or one of its descendants matches the filter
+     */
+    bool filterAcceptsIndexedRow(int source_row,
+                                 const QModelIndex& source_parent) const;
+
+    /**
+     * @brief Additional condition an item has to fulfill to match the
+     * filter. Items not fulfilling it are still accepted if one of their
+     * descendants matches.
+     * @param source_index Index of the item in the source model
+     * @return Whether the item may match the filter
+     */
+    virtual bool acceptsSourceIndex(const QModelIndex& source_index) const;
+
+    /**
+     * @brief Discards the filter index. Must be called if the result of
+     * acceptsSourceIndex changes.
+     */
+    void invalidateFilterIndex();
+
     /**
      * @brief Same as filterAcceptsRow, but also checks the predicate pred(obj)
-     *        weather to accept this object or not in addition
+     *        weather to accept this object or not in addition.
+     *        Searches the subtree of the row instead of using the filter index.
      *
      * @param source_row
      * @param source_parent
@@ -88,6 +137,9 @@ protected:
         return false;
     }
 
+private:
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
 };
 
 #endif // GTTREEFILTERMODEL_H
@@ -0,0 +1,54 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_modulesavestate.h"
+
+#include "gt_object.h"
+
+void
+GtModuleSaveState::setFileHash(const QString& mid, const QByteArray& fileHash)
+{
+    m_entries.insert(mid, Entry{fileHash, QString{}});
+}
+
+QByteArray
+GtModuleSaveState::fileHash(const QString& mid) const
+{
+    return m_entries.value(mid).fileHash;
+}
+
+void
+GtModuleSaveState::setSaved(const QString& mid, const QByteArray& fileHash,
+                            const GtObject& package)
+{
+    m_entries.insert(mid, Entry{fileHash, package.calcHash()});
+}
+
+void
+GtModuleSaveState::remove(const QString& mid)
+{
+    m_entries.remove(mid);
+}
+
+void
+GtModuleSaveState::clear()
+{
+    m_entries.clear();
+}
+
+bool
+GtModuleSaveState::needsSaving(const QString& mid,
+                               const GtObject& package) const
+{
+    auto iter = m_entries.constFind(mid);
+
+    if (iter == m_entries.constEnd() || iter->dataHash.isEmpty())
+    {
+        return true;
+    }
+
+    return package.calcHash() != iter->dataHash;
+}
@@ -0,0 +1,91 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTMODULESAVESTATE_H
+#define GTMODULESAVESTATE_H
+
+#include "gt_core_exports.h"
+
+#include <QHash>
+#include <QString>
+
+class GtObject;
+
+/**
+ * @brief Keeps track of the module files of a project that match their
+ * packages. The state of a module consists of the hash of its module file,
+ * which is stored in the project file, and the hash of the package data
+ * that was read from or written into the file.
+ *
+ * Whether a package changed is decided by comparing the hash of its data,
+ * hence the change flags of the objects, which are reset in many places,
+ * are not taken into account.
+ */
+class GT_CORE_EXPORT GtModuleSaveState
+{
+public:
+    /**
+     * @brief Sets the hash of the module file as stored in the project file.
+     * The package data is unknown until the package is read (setSaved).
+     * @param mid Module identification string
+     * @param fileHash Hash of the module file
+     */
+    void setFileHash(const QString& mid, const QByteArray& fileHash);
+
+    /**
+     * @brief Returns the hash of the module file
+     * @param mid Module identification string
+     * @return File hash. Empty if the module file is unknown.
+     */
+    QByteArray fileHash(const QString& mid) const;
+
+    /**
+     * @brief Marks the package as being saved in the module file with the
+     * given hash, i.e. after it was read from or written into the file.
+     * @param mid Module identification string
+     * @param fileHash Hash of the module file
+     * @param package Package stored in the module file
+     */
+    void setSaved(const QString& mid, const QByteArray& fileHash,
+                  const GtObject& package);
+
+    /**
+     * @brief Forgets the state of the module. Its file will be written on
+     * next save.
+     * @param mid Module identification string
+     */
+    void remove(const QString& mid);
+
+    /**
+     * @brief Forgets the states of all modules
+     */
+    void clear();
+
+    /**
+     * @brief Returns whether the package differs from the data stored in
+     * its module file.
+     * @param mid Module identification string
+     * @param package Module package
+     * @return True if the module file has to be written
+     */
+    bool needsSaving(const QString& mid, const GtObject& package) const;
+
+private:
+    /// State of a module file
+    struct Entry
+    {
+        /// hash of the module file
+        QByteArray fileHash;
+
+        /// hash of the package data stored in the file (empty if unknown)
+        QString dataHash;
+    };
+
+    /// states by module id
+    QHash<QString, Entry> m_entries;
+};
+
+#endif // GTMODULESAVESTATE_H
@@ -21,8 +21,88 @@
 
 #include "gt_downloader.h"
 
+#include <algorithm>
+
+namespace
+{
+
+/// Suffix of partially downloaded files
+QString
+partSuffix()
+{
+    return QStringLiteral(".part");
+}
+
+/// Suffix of the file storing the validator (entity tag or modification
+/// date) of a partially downloaded file
+QString
+validatorSuffix()
+{
+    return QStringLiteral(".part.validator");
+}
+
+/// Returns the validator of the reply, which is used to check whether the
+/// file changed before resuming its download. Weak entity tags cannot be
+/// used for range requests
+QByteArray
+validator(const QNetworkReply& reply)
+{
+    QByteArray etag = reply.rawHeader("ETag");
+    if (!etag.isEmpty() && !etag.startsWith("W/"))
+    {
+        return etag;
+    }
+
+    return reply.rawHeader("Last-Modified");
+}
+
+/// Reads the validator stored for the partial file of the item
+QByteArray
+readValidator(const GtDownloadItem& item)
+{
+    QFile file(item.filePath() + validatorSuffix());
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return {};
+    }
+
+    return file.readAll().trimmed();
+}
+
+/// Stores the validator for the partial file of the item
+void
+writeValidator(const GtDownloadItem& item, const QByteArray& validator)
+{
+    QFile file(item.filePath() + validatorSuffix());
+
+    if (validator.isEmpty() || !file.open(QIODevice::WriteOnly))
+    {
+        file.remove();
+        return;
+    }
+
+    file.write(validator);
+}
+
+/// Removes the validator stored for the partial file of the item
+void
+removeValidator(const GtDownloadItem& item)
+{
+    QFile::remove(item.filePath() + validatorSuffix());
+}
+
+/// Returns the http status code of the reply (0 for non http replies)
+int
+statusCode(const QNetworkReply& reply)
+{
+    return reply.attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+}
+
+} // namespace
+
 GtDownloader::GtDownloader(QObject* parent) : QObject(parent),
-    m_current(nullptr), m_requestAborted(false), m_numberOfFiles(0)
+    m_requestAborted(false), m_numberOfFiles(0), m_numberOfFinished(0),
+    m_numberOfFailed(0), m_maxParallel(4)
 {
 
 }
@@ -31,24 +111,29 @@ void
 GtDownloader::addFileDownload(const QString& url, const QString& downloadPath,
                               const QString& targetFileName)
 {
-    auto downloadItem = new GtDownloadItem(this);
-
-    downloadItem->m_url = QUrl(url);
-    downloadItem->m_path = downloadPath;
-    downloadItem->m_targetFileName = targetFileName;
-
-    m_queue << downloadItem;
+    addFileDownload(QUrl(url), downloadPath, targetFileName);
 }
 
 void
 GtDownloader::addFileDownload(const QUrl& url, const QString& downloadPath,
                               const QString& targetFileName)
+{
+    addFileDownload(url, downloadPath, targetFileName, QByteArray());
+}
+
+void
+GtDownloader::addFileDownload(const QUrl& url, const QString& downloadPath,
+                              const QString& targetFileName,
+                              const QByteArray& checksum,
+                              QCryptographicHash::Algorithm algorithm)
 {
     auto downloadItem = new GtDownloadItem(this);
 
     downloadItem->m_url = url;
     downloadItem->m_path = downloadPath;
     downloadItem->m_targetFileName = targetFileName;
+    downloadItem->m_checksum = checksum.toLower();
+    downloadItem->m_algorithm = algorithm;
 
     m_queue << downloadItem;
 }
@@ -59,127 +144,358 @@ GtDownloader::queueSize() const
     return m_queue.size();
 }
 
+void
+GtDownloader::setMaxParallelDownloads(int max)
+{
+    m_maxParallel = std::max(1, max);
+}
+
+int
+GtDownloader::maxParallelDownloads() const
+{
+    return m_maxParallel;
+}
+
 void
 GtDownloader::exec()
 {
-    if (m_current)
+    if (!m_active.isEmpty())
     {
         gtError() << tr("Could not start download proccess!") <<
                   QStringLiteral(" ") << tr("Download already running!");
         return;
     }
 
+    m_requestAborted = false;
     m_numberOfFiles = m_queue.size();
+    m_numberOfFinished = 0;
+    m_numberOfFailed = 0;
 
     QString msg = QString::number(m_queue.size()) + QStringLiteral(" ") +
                   tr("items(s) in queue.");
     emit message(msg);
 
-    loadNextItem();
+    loadNextItems();
 }
 
 void
-GtDownloader::loadNextItem()
+GtDownloader::loadNextItems()
 {
-    emit queueChanged(m_numberOfFiles - m_queue.size(), m_numberOfFiles);
-
-    if (m_queue.isEmpty())
-    {
-        gtInfo() << tr("All files downloaded!");
-        emit message(tr("All files downloaded!"));
-        emit finished();
-        return;
-    }
+    emit queueChanged(m_numberOfFinished, m_numberOfFiles);
 
     if (m_requestAborted)
     {
+        // wait for the aborted downloads
+        if (!m_active.isEmpty())
+        {
+            return;
+        }
+
         gtInfo() << tr("Download process aborted!");
         qDeleteAll(m_queue);
         m_queue.clear();
-        m_current = nullptr;
         return;
     }
 
-    m_current = m_queue.takeFirst();
+    if (m_queue.isEmpty() && m_active.isEmpty())
+    {
+        if (m_numberOfFailed > 0)
+        {
+            QString msg = QString::number(m_numberOfFailed) +
+                          QStringLiteral(" ") +
+                          tr("file(s) could not be downloaded!");
+            gtWarning() << msg;
+            emit message(msg);
+        }
+        else
+        {
+            gtInfo() << tr("All files downloaded!");
+            emit message(tr("All files downloaded!"));
+        }
+        emit finished();
+        return;
+    }
 
-    emit message(tr("downloading ") + m_current->url().toDisplayString() +
-                 QStringLiteral("..."));
+    while (!m_queue.isEmpty() && m_active.size() < m_maxParallel)
+    {
+        GtDownloadItem* item = m_queue.takeFirst();
 
-    QNetworkReply* reply =
-        gtAccessManager->qnam()->get(QNetworkRequest(m_current->url()));
+        if (!startDownload(*item))
+        {
+            m_numberOfFinished++;
+            m_numberOfFailed++;
+            delete item;
+            emit queueChanged(m_numberOfFinished, m_numberOfFiles);
+        }
+    }
 
-    connect(reply, SIGNAL(finished()), SLOT(onReplyFinished()));
+    // all remaining items failed to start
+    if (m_queue.isEmpty() && m_active.isEmpty())
+    {
+        loadNextItems();
+    }
 }
 
-void
-GtDownloader::onReplyFinished()
+bool
+GtDownloader::startDownload(GtDownloadItem& item)
 {
-    QNetworkReply* reply = qobject_cast<QNetworkReply*>(sender());
+    QDir dir(item.path());
 
-    if (!reply)
+    if (!dir.exists() && !dir.mkpath(item.path()))
     {
-        gtError() << tr("Invalid download reply!");
-        return;
+        gtError() << tr("Could not create directory!");
+        gtError() << "  |-> " << item.path();
+        return false;
     }
 
-    if (reply->error() || !m_current)
+    // resume partially downloaded files
+    item.m_file.setFileName(item.filePath() + partSuffix());
+
+    if (!item.m_file.open(QIODevice::ReadWrite))
     {
-        gtError() << tr("Could not download data!");
+        gtError() << tr("Could not save file!");
+        gtError() << "  |-> " << item.m_file.fileName();
+        return false;
     }
-    else
+
+    // partial files are only resumed if a change of the file is detected,
+    // either by the server using the validator or by the checksum
+    QByteArray const validator = readValidator(item);
+
+    if (validator.isEmpty() && item.m_checksum.isEmpty() &&
+        item.m_file.size() > 0)
     {
-        QDir dir(m_current->path());
+        item.m_file.resize(0);
+    }
+
+    item.m_hash = std::make_unique<QCryptographicHash>(item.m_algorithm);
+
+    if (!item.m_checksum.isEmpty())
+    {
+        item.m_hash->addData(&item.m_file);
+    }
+
+    qint64 const offset = item.m_file.size();
+    item.m_file.seek(offset);
 
-        if (!dir.exists())
+    item.m_accepted = false;
+    item.m_statusChecked = false;
+
+    QNetworkRequest request(item.url());
+    request.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
+                         QNetworkRequest::NoLessSafeRedirectPolicy);
+
+    if (offset > 0)
+    {
+        request.setRawHeader("Range", "bytes=" + QByteArray::number(offset) +
+                                      "-");
+
+        // the server sends the whole file if it changed
+        if (!validator.isEmpty())
         {
-            if (!dir.mkpath(m_current->path()))
-            {
-                gtError() << tr("Could not create directory!");
-            }
+            request.setRawHeader("If-Range", validator);
         }
+        emit message(tr("resuming ") + item.url().toDisplayString() +
+                     QStringLiteral("..."));
+    }
+    else
+    {
+        emit message(tr("downloading ") + item.url().toDisplayString() +
+                     QStringLiteral("..."));
+    }
+
+    QNetworkReply* reply = gtAccessManager->qnam()->get(request);
+    item.m_reply = reply;
+
+    m_active.append(&item);
+
+    GtDownloadItem* itemPtr = &item;
+    connect(reply, &QNetworkReply::readyRead, this, [this, itemPtr]() {
+        writeReplyData(*itemPtr);
+    });
+    connect(reply, &QNetworkReply::finished, this, [this, itemPtr]() {
+        onReplyFinished(itemPtr);
+    });
+
+    return true;
+}
+
+void
+GtDownloader::writeReplyData(GtDownloadItem& item)
+{
+    QNetworkReply* reply = item.m_reply;
 
-        QString filename = m_current->path() + QDir::separator()
-                           + m_current->targetFileName();
+    if (!item.m_statusChecked)
+    {
+        item.m_statusChecked = true;
+
+        int const status = statusCode(*reply);
+        item.m_accepted = status == 0 || status == 200 || status == 206;
+
+        // the server ignored the range request or the file changed, the
+        // whole file is sent
+        if (item.m_accepted && status != 206 && item.m_file.pos() > 0)
+        {
+            item.m_file.resize(0);
+            item.m_file.seek(0);
+            item.m_hash->reset();
+        }
 
-        if (QFile::exists(filename))
+        if (item.m_accepted)
         {
-            gtWarning() << "...overwriting...";
-            QFile::remove(filename);
+            writeValidator(item, validator(*reply));
         }
+    }
+
+    QByteArray const data = reply->readAll();
+
+    if (!item.m_accepted || data.isEmpty())
+    {
+        return;
+    }
+
+    if (item.m_file.write(data) != data.size())
+    {
+        gtError() << tr("Could not save file!");
+        gtError() << "  |-> " << item.m_file.fileName();
+        reply->abort();
+        return;
+    }
+
+    if (!item.m_checksum.isEmpty())
+    {
+        item.m_hash->addData(data);
+    }
+}
+
+void
+GtDownloader::onReplyFinished(GtDownloadItem* item)
+{
+    QNetworkReply* reply = item->m_reply;
+    item->m_reply = nullptr;
 
-        QFile file(filename);
+    reply->disconnect(this);
+    reply->deleteLater();
+
+    m_active.removeOne(item);
+
+    bool success = false;
+
+    if (m_requestAborted)
+    {
+        // the partial file is kept to resume the download later on
+        item->m_file.close();
+        delete item;
+        loadNextItems();
+        return;
+    }
+
+    if (statusCode(*reply) == 416 && !item->m_restarted)
+    {
+        // the partial file does not match the requested file, start over
+        item->m_file.remove();
+        removeValidator(*item);
+        item->m_restarted = true;
+        m_queue.prepend(item);
+        loadNextItems();
+        return;
+    }
+
+    if (reply->error())
+    {
+        gtError() << tr("Could not download data!");
+        gtError() << "  |-> " << item->url().toDisplayString()
+                  << reply->errorString();
+
+        // the partial file is kept to resume the download later on
+        if (item->m_file.size() == 0)
+        {
+            item->m_file.remove();
+            removeValidator(*item);
+        }
+        else
+        {
+            item->m_file.close();
+        }
+    }
+    else
+    {
+        writeReplyData(*item);
 
-        if (!file.open(QIODevice::WriteOnly))
+        if (item->m_accepted)
         {
-            gtError() << tr("Could not save file!");
-            gtError() << "  |-> " << filename;
+            success = completeFile(*item);
         }
         else
         {
-            file.write(reply->readAll());
-            file.flush();
-            file.close();
-            gtInfo() << tr("done!");
-            emit message(tr("done!"));
+            gtError() << tr("Could not download data!");
+            gtError() << "  |-> " << item->url().toDisplayString()
+                      << statusCode(*reply);
+            item->m_file.close();
         }
     }
 
-    delete m_current;
-    m_current = nullptr;
+    m_numberOfFinished++;
+    if (!success) m_numberOfFailed++;
 
-    reply->deleteLater();
+    delete item;
+
+    loadNextItems();
+}
+
+bool
+GtDownloader::completeFile(GtDownloadItem& item)
+{
+    item.m_file.close();
+
+    if (!item.m_checksum.isEmpty() &&
+        item.m_hash->result().toHex() != item.m_checksum)
+    {
+        gtError() << tr("Checksum mismatch, discarding file!");
+        gtError() << "  |-> " << item.url().toDisplayString();
+        item.m_file.remove();
+        removeValidator(item);
+        return false;
+    }
+
+    QString const filename = item.filePath();
 
-    loadNextItem();
+    if (QFile::exists(filename))
+    {
+        gtWarning() << "...overwriting...";
+        QFile::remove(filename);
+    }
+
+    if (!item.m_file.rename(filename))
+    {
+        gtError() << tr("Could not save file!");
+        gtError() << "  |-> " << filename;
+        return false;
+    }
+
+    removeValidator(item);
+
+    gtInfo() << tr("done!");
+    emit message(tr("done!"));
+
+    return true;
 }
 
 void
 GtDownloader::cancelDownload()
 {
-    if (!m_current)
+    if (m_active.isEmpty())
     {
         gtInfo() << tr("Download process not active!");
         return;
     }
 
     m_requestAborted = true;
+
+    // aborting emits the finished signal of the replies
+    auto const active = m_active;
+    for (GtDownloadItem* item : active)
+    {
+        if (item->m_reply) item->m_reply->abort();
+    }
 }
@@ -14,9 +14,22 @@
 #include "gt_core_exports.h"
 
 #include <QObject>
+#include <QCryptographicHash>
 
 class GtDownloadItem;
 
+/**
+ * @brief The GtDownloader class
+ * Downloads the queued files in parallel (see setMaxParallelDownloads).
+ * The data is written into a partial file (*.part) while receiving it.
+ * Partial files of interrupted downloads are resumed using HTTP range
+ * requests. The entity tag or modification date of the file is stored next
+ * to the partial file (*.part.validator) and sent along with the range
+ * request, thus a changed file is downloaded again. Partial files without
+ * validator are only resumed if a checksum is given. The partial file
+ * replaces the target file once the download is completed and its
+ * checksum, if given, has been verified.
+ */
 class GT_CORE_EXPORT GtDownloader : public QObject
 {
     Q_OBJECT
@@ -46,12 +59,39 @@ public:
     void addFileDownload(const QUrl& url, const QString& downloadPath,
                          const QString& targetFileName = QString());
 
+    /**
+     * @brief Adds a file download whose data is verified using the given
+     * checksum. Files not matching the checksum are discarded.
+     * @param url Url of the file
+     * @param downloadPath Target directory
+     * @param targetFileName Target file name
+     * @param checksum Expected checksum (hex encoded)
+     * @param algorithm Checksum algorithm
+     */
+    void addFileDownload(const QUrl& url, const QString& downloadPath,
+                         const QString& targetFileName,
+                         const QByteArray& checksum,
+                         QCryptographicHash::Algorithm algorithm =
+                             QCryptographicHash::Sha256);
+
     /**
      * @brief queueSize
      * @return
      */
     int queueSize() const;
 
+    /**
+     * @brief Sets the maximum number of files downloaded at the same time
+     * @param max Maximum number of parallel downloads (at least 1)
+     */
+    void setMaxParallelDownloads(int max);
+
+    /**
+     * @brief Returns the maximum number of files downloaded at the same time
+     * @return Maximum number of parallel downloads
+     */
+    int maxParallelDownloads() const;
+
 public slots:
     /**
      * @brief exec
@@ -67,8 +107,8 @@ private:
     /// Queue.
     QList<GtDownloadItem*> m_queue;
 
-    /// Current download item.
-    GtDownloadItem* m_current;
+    /// Active download items.
+    QList<GtDownloadItem*> m_active;
 
     /// Request aborted flag.
     bool m_requestAborted;
@@ -76,16 +116,48 @@ private:
     /// Number of files to download.
     int m_numberOfFiles;
 
+    /// Number of files processed.
+    int m_numberOfFinished;
+
+    /// Number of files that could not be downloaded.
+    int m_numberOfFailed;
+
+    /// Maximum number of parallel downloads.
+    int m_maxParallel;
+
+    /**
+     * @brief Starts downloading queued items until the maximum number of
+     * parallel downloads is reached
+     */
+    void loadNextItems();
+
+    /**
+     * @brief Opens the partial file of the item and requests the remaining
+     * data
+     * @param item Download item
+     * @return Whether the download has been started
+     */
+    bool startDownload(GtDownloadItem& item);
+
+    /**
+     * @brief Writes the data received so far into the partial file
+     * @param item Download item
+     */
+    void writeReplyData(GtDownloadItem& item);
+
     /**
-     * @brief loadNextItem
+     * @brief Completes the download of the item once its reply is finished
+     * @param item Download item
      */
-    void loadNextItem();
+    void onReplyFinished(GtDownloadItem* item);
 
-private slots:
     /**
-     * @brief httpFinished
+     * @brief Verifies the checksum of the partial file and moves it to
+     * the target file
+     * @param item Download item
+     * @return Success
      */
-    void onReplyFinished();
+    bool completeFile(GtDownloadItem& item);
 
 signals:
     /**
@@ -9,8 +9,9 @@
  *  Tel.: +49 2203 601 2907
  */
 
-#include "gt_downloaditem.h"
+#include <QDir>
 
+#include "gt_downloaditem.h"
 
 GtDownloadItem::GtDownloadItem(QObject* parent) : QObject(parent)
 {
@@ -34,3 +35,18 @@ GtDownloadItem::targetFileName() const
 {
     return m_targetFileName;
 }
+
+QString
+GtDownloadItem::filePath() const
+{
+    QString const fileName = m_targetFileName.isEmpty() ? m_url.fileName() :
+                                                          m_targetFileName;
+
+    return m_path + QDir::separator() + fileName;
+}
+
+const QByteArray&
+GtDownloadItem::checksum() const
+{
+    return m_checksum;
+}
@@ -14,8 +14,14 @@
 
 #include <QObject>
 
+#include <QCryptographicHash>
+#include <QFile>
 #include <QUrl>
 
+#include <memory>
+
+class QNetworkReply;
+
 /**
  * @brief The GtDownloadItem class
  */
@@ -44,6 +50,19 @@ public:
      */
     const QString& targetFileName() const;
 
+    /**
+     * @brief Returns the path of the downloaded file. Uses the file name of
+     * the url if no target file name is set.
+     * @return File path
+     */
+    QString filePath() const;
+
+    /**
+     * @brief Returns the expected checksum of the file (hex encoded)
+     * @return Checksum. Empty if the file is not checked
+     */
+    const QByteArray& checksum() const;
+
 private:
     /// Url.
     QUrl m_url;
@@ -54,6 +73,30 @@ private:
     /// Target filename.
     QString m_targetFileName;
 
+    /// Expected checksum (hex encoded).
+    QByteArray m_checksum;
+
+    /// Checksum algorithm.
+    QCryptographicHash::Algorithm m_algorithm{QCryptographicHash::Sha256};
+
+    /// Partially downloaded file.
+    QFile m_file;
+
+    /// Checksum of the data written to the file.
+    std::unique_ptr<QCryptographicHash> m_hash;
+
+    /// Active reply.
+    QNetworkReply* m_reply{nullptr};
+
+    /// Whether the reply contains data to write to the file.
+    bool m_accepted{false};
+
+    /// Whether the status of the reply has been checked.
+    bool m_statusChecked{false};
+
+    /// Whether the download has been restarted from the beginning.
+    bool m_restarted{false};
+
     /**
      * @brief GtDownloadItem
      * @param parent
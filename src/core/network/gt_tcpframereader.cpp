@@ -0,0 +1,163 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_tcpframereader.h"
+
+#include <QtEndian>
+
+#include <limits>
+
+namespace
+{
+
+/// Maximum number of digits of an ascii size prefix
+constexpr int S_MAX_SIZE_DIGITS = 10;
+
+/// Payload of the hello message
+constexpr const char* S_HELLO_PAYLOAD =
+    R"(<object class="GtTcpHello" name="Hello"/>)";
+
+inline bool
+isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+} // namespace
+
+QByteArray
+gt::tcp::frameHeader(FrameType type, qint64 size)
+{
+    QByteArray header(S_FRAME_HEADER_SIZE, Qt::Uninitialized);
+
+    auto* data = reinterpret_cast<uchar*>(header.data());
+    qToBigEndian<quint32>(S_FRAME_MAGIC, data);
+    qToBigEndian<quint32>(type, data + 4);
+    qToBigEndian<qint64>(size, data + 8);
+
+    return header;
+}
+
+QByteArray
+gt::tcp::helloMessage()
+{
+    QByteArray payload{S_HELLO_PAYLOAD};
+    return QByteArray::number(payload.size()) + payload;
+}
+
+void
+GtTcpFrameReader::append(const QByteArray& data)
+{
+    if (data.isEmpty())
+    {
+        return;
+    }
+
+    // remove data read so far only once per append
+    if (m_pos > 0)
+    {
+        m_buffer.remove(0, m_pos);
+        m_pos = 0;
+    }
+
+    m_buffer.append(data);
+}
+
+GtTcpFrameReader::Status
+GtTcpFrameReader::readFrame(Frame& frame)
+{
+    const int available = m_buffer.size() - m_pos;
+
+    if (available <= 0)
+    {
+        return Incomplete;
+    }
+
+    const char* begin = m_buffer.constData() + m_pos;
+
+    qint64 size = 0;
+    int headerSize = 0;
+
+    if (isDigit(*begin))
+    {
+        // data prefixed by its size as ascii decimal number
+        while (headerSize < available && isDigit(begin[headerSize]))
+        {
+            if (headerSize == S_MAX_SIZE_DIGITS)
+            {
+                return Invalid;
+            }
+
+            size = size * 10 + (begin[headerSize] - '0');
+            ++headerSize;
+        }
+
+        // size may not be complete yet
+        if (headerSize == available)
+        {
+            return Incomplete;
+        }
+
+        frame.type = gt::tcp::DataFrame;
+        frame.binary = false;
+    }
+    else
+    {
+        headerSize = gt::tcp::S_FRAME_HEADER_SIZE;
+
+        if (available < headerSize)
+        {
+            return Incomplete;
+        }
+
+        auto const* data = reinterpret_cast<const uchar*>(begin);
+
+        if (qFromBigEndian<quint32>(data) != gt::tcp::S_FRAME_MAGIC)
+        {
+            return Invalid;
+        }
+
+        frame.type = static_cast<gt::tcp::FrameType>(
+            qFromBigEndian<quint32>(data + 4));
+        frame.binary = true;
+        size = qFromBigEndian<qint64>(data + 8);
+    }
+
+    if (size < 0 || size > std::numeric_limits<int>::max() - headerSize)
+    {
+        return Invalid;
+    }
+
+    if (available - headerSize < size)
+    {
+        return Incomplete;
+    }
+
+    // refer to the payload without copying it
+    frame.payload = QByteArray::fromRawData(begin + headerSize,
+                                            static_cast<int>(size));
+    m_pos += headerSize + static_cast<int>(size);
+
+    if (!frame.binary && frame.payload == S_HELLO_PAYLOAD)
+    {
+        frame.type = gt::tcp::HelloFrame;
+    }
+
+    return FrameRead;
+}
+
+void
+GtTcpFrameReader::clear()
+{
+    m_buffer.clear();
+    m_pos = 0;
+}
+
+bool
+GtTcpFrameReader::isEmpty() const
+{
+    return m_pos >= m_buffer.size();
+}
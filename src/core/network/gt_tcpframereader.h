@@ -0,0 +1,125 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTTCPFRAMEREADER_H
+#define GTTCPFRAMEREADER_H
+
+#include "gt_core_exports.h"
+
+#include <QByteArray>
+
+namespace gt
+{
+namespace tcp
+{
+
+/**
+ * @brief Type of a binary frame
+ */
+enum FrameType : quint32
+{
+    /// Frame containing message data
+    DataFrame = 0,
+    /// Frame announcing that binary frames are understood (see helloMessage)
+    HelloFrame = 1
+};
+
+/// Magic number at the beginning of each binary frame ("GTBF")
+constexpr quint32 S_FRAME_MAGIC = 0x47544246;
+
+/// Size of the binary frame header (magic, frame type and payload size)
+constexpr int S_FRAME_HEADER_SIZE = 16;
+
+/**
+ * @brief Creates the header of a binary frame. All values are stored in big
+ * endian byte order.
+ * @param type Frame type
+ * @param size Size of the payload
+ * @return Frame header
+ */
+GT_CORE_EXPORT QByteArray frameHeader(FrameType type, qint64 size);
+
+/**
+ * @brief Creates the message announcing that binary frames are understood.
+ * The message is prefixed by its size and contains an object of a class that
+ * is unknown to peers not supporting binary frames, thus they discard it.
+ * @return Hello message
+ */
+GT_CORE_EXPORT QByteArray helloMessage();
+
+} // namespace tcp
+
+} // namespace gt
+
+/**
+ * @brief The GtTcpFrameReader class.
+ * Buffers the data received from a tcp socket and splits it into frames.
+ * Supports binary frames (see gt::tcp::frameHeader) as well as data prefixed
+ * by its size as ascii decimal number. Frames are parsed in place, consumed
+ * data is only removed from the buffer when new data is appended.
+ */
+class GT_CORE_EXPORT GtTcpFrameReader
+{
+public:
+
+    /**
+     * @brief Result of reading a frame
+     */
+    enum Status
+    {
+        FrameRead,  // a complete frame was read
+        Incomplete, // more data is required
+        Invalid     // the data is corrupted
+    };
+
+    /**
+     * @brief A frame read from the buffer
+     */
+    struct Frame
+    {
+        /// Frame type (always data for size prefixed frames)
+        gt::tcp::FrameType type{gt::tcp::DataFrame};
+        /// Whether the frame is a binary frame
+        bool binary{false};
+        /// Payload of the frame. Refers to the internal buffer and is only
+        /// valid until new data is appended or the buffer is cleared.
+        QByteArray payload;
+    };
+
+    /**
+     * @brief Appends received data to the buffer
+     * @param data Received data
+     */
+    void append(const QByteArray& data);
+
+    /**
+     * @brief Reads the next complete frame from the buffer
+     * @param frame Frame to read into
+     * @return Status
+     */
+    Status readFrame(Frame& frame);
+
+    /**
+     * @brief Clears the buffer
+     */
+    void clear();
+
+    /**
+     * @brief Returns whether all data of the buffer was read
+     * @return Whether the buffer is empty
+     */
+    bool isEmpty() const;
+
+private:
+
+    /// Received data
+    QByteArray m_buffer;
+
+    /// Position of the next frame in the buffer
+    int m_pos{0};
+};
+
+#endif // GTTCPFRAMEREADER_H
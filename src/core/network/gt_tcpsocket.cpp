@@ -15,6 +15,7 @@
 
 #include "gt_logging.h"
 #include "gt_eventloop.h"
+#include "gt_tcpframereader.h"
 
 #include <QHostInfo>
 #include <QHostAddress>
@@ -113,7 +114,13 @@ GtTcpSocket::write(GtEventLoop& loop, const QByteArray& data, DataFormat format)
     {
     // preprend the data size to the data itself
     case PrependDataSize:
-        m_socket->write(QByteArray::number(data.size()) + data);
+        m_socket->write(QByteArray::number(data.size()));
+        m_socket->write(data);
+        break;
+    // prepend the binary frame header
+    case BinaryFrame:
+        m_socket->write(gt::tcp::frameHeader(gt::tcp::DataFrame, data.size()));
+        m_socket->write(data);
         break;
     // by default write data as raw
     default:
@@ -39,8 +39,9 @@ public:
      */
     enum DataFormat
     {
-        RawData,        // Write the data as is
-        PrependDataSize // preprend the length of the data to the data itself
+        RawData,         // Write the data as is
+        PrependDataSize, // preprend the length of the data to the data itself
+        BinaryFrame      // write the data as binary frame (see GtTcpFrameReader)
     };
 
     /**
@@ -8,17 +8,147 @@
  *		  Tel.: +49 2203 601 2859
  */
 
+#include <QCryptographicHash>
+#include <QHash>
+#include <QSet>
+
 #include "gt_processcomponent.h"
+#include "gt_objectfactory.h"
+#include "gt_logging.h"
 
 #include "gt_abstractrunnable.h"
 
-GtAbstractRunnable::GtAbstractRunnable() : m_successfulRun(false)
+namespace
+{
+
+/// Returns the hash of the properties of the object
+QByteArray
+propertyHash(const GtObject& obj)
+{
+    return QCryptographicHash::hash(
+        GtObjectMemento::propertiesOnly(obj).toByteArray(),
+        QCryptographicHash::Sha256);
+}
+
+/// Returns the uuids of the direct children of the object
+QSet<QString>
+childUuids(const GtObject& obj)
+{
+    QSet<QString> retval;
+
+    for (const GtObject* child : obj.childObjects())
+    {
+        retval.insert(child->uuid());
+    }
+
+    return retval;
+}
+
+} // namespace
+
+struct GtAbstractRunnable::Impl
+{
+    /// Transferred state of a partial object
+    struct PartialObject
+    {
+        /// hash of the properties
+        QByteArray propertyHash;
+
+        /// uuids of the transferred children
+        QSet<QString> children;
+    };
+
+    /// provider for source data fetched on demand
+    SourceDataProvider provider;
+
+    /// partial objects by uuid
+    QHash<QString, PartialObject> partialObjects;
+
+    /// source data fetched on demand, which is not part of the linked objects
+    QList<GtObject*> fetchedObjects;
+
+    /// uuids and paths, which could not be fetched
+    QSet<QString> unknown;
+
+    bool isPartial(const GtObject& obj) const
+    {
+        return partialObjects.contains(obj.uuid());
+    }
+
+    /// Stores the transferred state of the partial object
+    void initPartial(const GtObject& obj)
+    {
+        partialObjects.insert(obj.uuid(),
+                              PartialObject{propertyHash(obj), childUuids(obj)});
+    }
+
+    /// Returns whether the properties or children of the partial object
+    /// changed since it was transferred
+    bool isModified(const GtObject& obj) const
+    {
+        auto iter = partialObjects.constFind(obj.uuid());
+
+        return iter != partialObjects.constEnd() &&
+               (iter->propertyHash != propertyHash(obj) ||
+                iter->children != childUuids(obj));
+    }
+
+    /**
+     * @brief Completes the partial object using the memento of the source
+     * object. Transferred children are kept, children deleted during the run
+     * are not restored.
+     * @param obj Partial object
+     * @param memento Memento of the source object
+     */
+    void complete(GtObject& obj, const GtObjectMemento& memento)
+    {
+        PartialObject const state = partialObjects.take(obj.uuid());
+
+        QList<GtObject*> children;
+
+        for (const GtObjectMemento& child : memento.childObjects)
+        {
+            if (GtObject* transferred = obj.getDirectChildByUuid(child.uuid()))
+            {
+                children.append(transferred);
+            }
+            else if (!state.children.contains(child.uuid()))
+            {
+                if (GtObject* restored = child.restore(gtObjectFactory))
+                {
+                    children.append(restored);
+                }
+            }
+        }
+
+        // children appended during the run are kept behind the source children
+        for (GtObject* child : obj.findDirectChildren())
+        {
+            if (!children.contains(child))
+            {
+                children.append(child);
+            }
+        }
+
+        // the children are appended in the order of the source object
+        for (GtObject* child : qAsConst(children))
+        {
+            child->setParent(nullptr);
+            obj.appendChild(child);
+        }
+    }
+};
+
+GtAbstractRunnable::GtAbstractRunnable() :
+    m_successfulRun(false),
+    pimpl(std::make_unique<Impl>())
 {
 }
 
 GtAbstractRunnable::~GtAbstractRunnable()
 {
     qDeleteAll(m_linkedObjects);
+    qDeleteAll(pimpl->fetchedObjects);
 }
 
 const QList<GtObject*>&
@@ -40,6 +170,39 @@ GtAbstractRunnable::appendSourceData(const GtObjectMemento& memento)
     //    }
 }
 
+void
+GtAbstractRunnable::setSourceDataProvider(SourceDataProvider provider)
+{
+    pimpl->provider = std::move(provider);
+}
+
+void
+GtAbstractRunnable::setPartialObjects(const QStringList& uuids)
+{
+    for (const QString& uuid : uuids)
+    {
+        pimpl->partialObjects.insert(uuid, {});
+    }
+}
+
+void
+GtAbstractRunnable::initPartialObjects()
+{
+    auto const uuids = pimpl->partialObjects.keys();
+
+    for (const QString& uuid : uuids)
+    {
+        for (GtObject* root : qAsConst(m_linkedObjects))
+        {
+            if (GtObject* obj = root->getObjectByUuid(uuid))
+            {
+                pimpl->initPartial(*obj);
+                break;
+            }
+        }
+    }
+}
+
 const QList<GtObjectMemento>&
 GtAbstractRunnable::outputData() const
 {
@@ -77,3 +240,164 @@ GtAbstractRunnable::successful()
 {
     return m_successfulRun;
 }
+
+QList<GtObject*>
+GtAbstractRunnable::outputObjects() const
+{
+    QList<GtObject*> retval;
+
+    std::function<void(GtObject*)> collect = [&](GtObject* obj) {
+        // modified partial objects are completed to write them back
+        if (pimpl->isPartial(*obj) && pimpl->isModified(*obj) &&
+            !fetchSourceData(obj->uuid(), {}))
+        {
+            gtWarning() << tr("Changes of '%1' could not be written back!")
+                           .arg(obj->objectName());
+        }
+
+        if (!pimpl->isPartial(*obj))
+        {
+            retval.append(obj);
+            return;
+        }
+
+        for (GtObject* child : obj->findDirectChildren())
+        {
+            collect(child);
+        }
+    };
+
+    for (GtObject* root : m_linkedObjects + pimpl->fetchedObjects)
+    {
+        collect(root);
+    }
+
+    return retval;
+}
+
+GtObject*
+GtAbstractRunnable::findData(const QString& uuid,
+                             const GtObjectPath& path) const
+{
+    auto find = [&]() -> GtObject* {
+        for (GtObject* root : m_linkedObjects + pimpl->fetchedObjects)
+        {
+            GtObject* obj = uuid.isEmpty() ? path.getObject(root) :
+                                             root->getObjectByUuid(uuid);
+            if (obj)
+            {
+                return obj;
+            }
+        }
+
+        return nullptr;
+    };
+
+    GtObject* obj = find();
+
+    // objects, which were not transferred completely, are fetched
+    if ((!obj || pimpl->isPartial(*obj)) && fetchSourceData(uuid, path))
+    {
+        obj = find();
+    }
+
+    return obj;
+}
+
+bool
+GtAbstractRunnable::fetchSourceData(const QString& uuid,
+                                    const GtObjectPath& path) const
+{
+    QString const key = uuid.isEmpty() ? path.toString() : uuid;
+
+    if (!pimpl->provider || key.isEmpty() || pimpl->unknown.contains(key))
+    {
+        return false;
+    }
+
+    QList<GtObjectMemento> const mementos = pimpl->provider(uuid, path);
+
+    bool success = !mementos.isEmpty();
+    GtObject* parent = nullptr;
+
+    // the fetched object is added to the transferred data together with its
+    // parents, which are partial unless they were fetched before
+    for (int i = 0; success && i < mementos.size(); ++i)
+    {
+        const GtObjectMemento& memento = mementos.at(i);
+        bool const isRequested = i == mementos.size() - 1;
+
+        GtObject* obj = nullptr;
+
+        if (parent)
+        {
+            obj = parent->getDirectChildByUuid(memento.uuid());
+        }
+        else
+        {
+            for (GtObject* root : m_linkedObjects + pimpl->fetchedObjects)
+            {
+                if (root->uuid() == memento.uuid())
+                {
+                    obj = root;
+                    break;
+                }
+            }
+        }
+
+        if (obj)
+        {
+            if (pimpl->isPartial(*obj))
+            {
+                if (isRequested) pimpl->complete(*obj, memento);
+            }
+            // the object was deleted from a complete parent during the run
+            else if (!isRequested)
+            {
+                success = false;
+            }
+
+            parent = obj;
+            continue;
+        }
+
+        obj = memento.restore(gtObjectFactory);
+
+        if (!obj)
+        {
+            success = false;
+            break;
+        }
+
+        if (!isRequested)
+        {
+            pimpl->initPartial(*obj);
+        }
+
+        if (parent)
+        {
+            parent->appendChild(obj);
+
+            // the child is part of the transferred state of its parent
+            auto iter = pimpl->partialObjects.find(parent->uuid());
+            if (iter != pimpl->partialObjects.end())
+            {
+                iter->children.insert(obj->uuid());
+            }
+        }
+        else
+        {
+            obj->enableUuidIndex();
+            pimpl->fetchedObjects.append(obj);
+        }
+
+        parent = obj;
+    }
+
+    if (!success)
+    {
+        pimpl->unknown.insert(key);
+    }
+
+    return success;
+}
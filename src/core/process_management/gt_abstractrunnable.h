@@ -15,6 +15,9 @@
 
 #include <QRunnable>
 
+#include <functional>
+#include <memory>
+
 #include "gt_object.h"
 #include "gt_objectpath.h"
 #include "gt_objectmemento.h"
@@ -32,6 +35,18 @@ class GT_CORE_EXPORT GtAbstractRunnable : public QObject,
 
 public:
 
+    /**
+     * @brief Function used to fetch source data, which was not transferred to
+     * the runnable beforehand. Either the uuid or the path of the requested
+     * object is set. Returns the mementos of the parents of the object,
+     * starting at the top level source object, followed by the memento of
+     * the object. The mementos of the parents only contain their properties.
+     * Returns an empty list if the object does not exist.
+     */
+    using SourceDataProvider =
+        std::function<QList<GtObjectMemento>(const QString& uuid,
+                                             const GtObjectPath& path)>;
+
     /**
      * @brief Constructor.
      */
@@ -54,6 +69,22 @@ public:
      */
     void appendSourceData(const GtObjectMemento& memento);
 
+    /**
+     * @brief Sets the provider used to fetch source data on first access,
+     * which is not part of the transferred source data.
+     * @param provider Source data provider
+     */
+    void setSourceDataProvider(SourceDataProvider provider);
+
+    /**
+     * @brief Marks transferred objects as partial. Partial objects only
+     * contain their properties and the children leading to linked objects.
+     * They are completed using the source data provider once they are
+     * accessed or modified.
+     * @param uuids Uuids of the partial objects
+     */
+    void setPartialObjects(const QStringList& uuids);
+
     /**
      * @brief sourceData
      * @return
@@ -115,20 +146,7 @@ public:
             return nullptr;
         }
 
-        for (GtObject* obj : qAsConst(m_linkedObjects))
-        {
-            if (!obj)
-            {
-                continue;
-            }
-
-            if (GtObject* retval = obj->getObjectByUuid(uuid))
-            {
-                return qobject_cast<T>(retval);
-            }
-        }
-
-        return nullptr;
+        return qobject_cast<T>(findData(uuid, {}));
     }
 
     /**
@@ -146,15 +164,7 @@ public:
             return nullptr;
         }
 
-        for (GtObject* obj : qAsConst(m_linkedObjects))
-        {
-            if (GtObject* retval = path.getObject(obj))
-            {
-                return qobject_cast<T>(retval);
-            }
-        }
-
-        return nullptr;
+        return qobject_cast<T>(findData({}, path));
     }
 
 protected:
@@ -173,6 +183,47 @@ protected:
     ///
     bool m_successfulRun;
 
+    /**
+     * @brief Stores the state of the partial objects, must be called once
+     * the linked objects are restored. Partial objects that are modified
+     * afterwards are written back completely.
+     */
+    void initPartialObjects();
+
+    /**
+     * @brief Returns the objects, whose data should be written back after a
+     * successful run. These are the linked objects and the source data
+     * fetched on demand, each including all of its children. Partial objects
+     * are only written back if they were modified, their other children are
+     * fetched beforehand.
+     * @return Objects to write back
+     */
+    QList<GtObject*> outputObjects() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+
+    /**
+     * @brief Returns the object with the given uuid or path. Objects, which
+     * were not transferred, and partial objects are fetched using the source
+     * data provider.
+     * @param uuid Uuid of the requested object (may be empty)
+     * @param path Path of the requested object (used if uuid is empty)
+     * @return Requested object. Null if not found.
+     */
+    GtObject* findData(const QString& uuid, const GtObjectPath& path) const;
+
+    /**
+     * @brief Fetches source data using the source data provider and adds it
+     * to the transferred data. A partial object is completed if it is the
+     * requested object.
+     * @param uuid Uuid of the requested object (may be empty)
+     * @param path Path of the requested object (used if uuid is empty)
+     * @return True if the object was fetched
+     */
+    bool fetchSourceData(const QString& uuid, const GtObjectPath& path) const;
+
 signals:
     /**
      * @brief runnableFinished
@@ -9,6 +9,8 @@
  *  Tel.: +49 2203 601 2907
  */
 
+#include <QSet>
+#include <QThread>
 #include <QThreadPool>
 
 #include "gt_logging.h"
@@ -17,12 +19,54 @@
 #include "gt_abstractrunnable.h"
 #include "gt_processdata.h"
 #include "gt_objectlinkproperty.h"
-#include "gt_processdata.h"
+#include "gt_objectpathproperty.h"
 #include "gt_labeldata.h"
 #include "gt_structproperty.h"
 
 #include "gt_taskrunner.h"
 
+namespace
+{
+
+/**
+ * @brief Creates a memento of the object, which only contains the linked
+ * objects and their parents. Parents of linked objects only contain their
+ * properties and the children leading to linked objects.
+ * @param obj Object
+ * @param linked Linked objects
+ * @param parents Parents of the linked objects
+ * @param partialUuids Uuids of the transferred parents
+ * @return Object memento
+ */
+GtObjectMemento
+linkedMemento(const GtObject& obj,
+              const QSet<const GtObject*>& linked,
+              const QSet<const GtObject*>& parents,
+              QStringList& partialUuids)
+{
+    if (linked.contains(&obj))
+    {
+        return obj.toMemento();
+    }
+
+    partialUuids.append(obj.uuid());
+
+    GtObjectMemento memento = GtObjectMemento::propertiesOnly(obj);
+
+    for (const GtObject* child : obj.childObjects())
+    {
+        if (linked.contains(child) || parents.contains(child))
+        {
+            memento.childObjects.push_back(
+                linkedMemento(*child, linked, parents, partialUuids));
+        }
+    }
+
+    return memento;
+}
+
+} // namespace
+
 GtTaskRunner::GtTaskRunner(GtTask* task) : m_task(task), m_runnable(nullptr),
     m_source(nullptr)
 {
@@ -73,19 +117,16 @@ GtTaskRunner::setUp(GtAbstractRunnable* runnable, GtObject* source)
     m_componentMap.clear();
 
     // transfer source meta data to runnable
-    foreach (GtObject* srcObj, m_source->findDirectChildren<GtObject*>())
+    if (m_linkedDataOnly)
     {
-        if (qobject_cast<GtProcessData*>(srcObj))
-        {
-            continue;
-        }
-
-        if (qobject_cast<GtLabelData*>(srcObj))
+        appendLinkedSourceData();
+    }
+    else
+    {
+        foreach (GtObject* srcObj, sourceObjects())
         {
-            continue;
+            m_runnable->appendSourceData(srcObj->toMemento());
         }
-
-        m_runnable->appendSourceData(srcObj->toMemento());
     }
 
     GtTask* taskCopy = cloneTask();
@@ -111,6 +152,12 @@ GtTaskRunner::setUp(GtAbstractRunnable* runnable, GtObject* source)
     return true;
 }
 
+void
+GtTaskRunner::setLinkedSourceDataOnly(bool val)
+{
+    m_linkedDataOnly = val;
+}
+
 void
 GtTaskRunner::run()
 {
@@ -258,6 +305,169 @@ GtTaskRunner::setupElements(GtProcessComponent* orig,
     return true;
 }
 
+QList<GtObject*>
+GtTaskRunner::sourceObjects() const
+{
+    QList<GtObject*> retval;
+
+    if (!m_source)
+    {
+        return retval;
+    }
+
+    foreach (GtObject* srcObj, m_source->findDirectChildren<GtObject*>())
+    {
+        if (qobject_cast<GtProcessData*>(srcObj))
+        {
+            continue;
+        }
+
+        if (qobject_cast<GtLabelData*>(srcObj))
+        {
+            continue;
+        }
+
+        retval.append(srcObj);
+    }
+
+    return retval;
+}
+
+GtObject*
+GtTaskRunner::findSourceObject(const QString& uuid,
+                               const GtObjectPath& path) const
+{
+    auto const srcObjs = sourceObjects();
+
+    for (GtObject* srcObj : srcObjs)
+    {
+        GtObject* obj = uuid.isEmpty() ? path.getObject(srcObj) :
+                                         srcObj->getObjectByUuid(uuid);
+        if (obj)
+        {
+            return obj;
+        }
+    }
+
+    return nullptr;
+}
+
+void
+GtTaskRunner::appendLinkedSourceData()
+{
+    // collect source objects referenced by the task and its components
+    QList<GtProcessComponent*> components =
+        m_task->findDescendants<GtProcessComponent*>();
+    components.prepend(m_task);
+
+    QSet<const GtObject*> linked;
+
+    for (GtProcessComponent* pc : qAsConst(components))
+    {
+        auto const props = pc->fullPropertyList();
+
+        for (GtAbstractProperty* prop : props)
+        {
+            GtObject* obj = nullptr;
+
+            if (auto* linkProp = qobject_cast<GtObjectLinkProperty*>(prop))
+            {
+                obj = findSourceObject(linkProp->linkedObjectUUID(), {});
+            }
+            else if (auto* pathProp = qobject_cast<GtObjectPathProperty*>(prop))
+            {
+                obj = findSourceObject({}, pathProp->path());
+            }
+
+            if (obj)
+            {
+                linked.insert(obj);
+            }
+        }
+    }
+
+    // parents of the linked objects are required to resolve object paths
+    QSet<const GtObject*> parents;
+
+    for (const GtObject* obj : qAsConst(linked))
+    {
+        for (const GtObject* p = obj->parentObject(); p && p != m_source.data();
+             p = p->parentObject())
+        {
+            parents.insert(p);
+        }
+    }
+
+    QStringList partialUuids;
+
+    foreach (GtObject* srcObj, sourceObjects())
+    {
+        if (linked.contains(srcObj) || parents.contains(srcObj))
+        {
+            m_runnable->appendSourceData(
+                linkedMemento(*srcObj, linked, parents, partialUuids));
+        }
+    }
+
+    // parents are completed once they are accessed or modified
+    m_runnable->setPartialObjects(partialUuids);
+
+    // any other source data is fetched on first access
+    QPointer<GtTaskRunner> runner(this);
+
+    m_runnable->setSourceDataProvider([runner](const QString& uuid,
+                                               const GtObjectPath& path) {
+        QList<GtObjectMemento> mementos;
+
+        if (!runner)
+        {
+            return mementos;
+        }
+
+        auto fetch = [&]() {
+            if (runner) mementos = runner->sourceData(uuid, path);
+        };
+
+        // source data must be accessed from the thread of the source
+        if (QThread::currentThread() == runner->thread())
+        {
+            fetch();
+        }
+        else
+        {
+            QMetaObject::invokeMethod(runner.data(), fetch,
+                                      Qt::BlockingQueuedConnection);
+        }
+
+        return mementos;
+    });
+}
+
+QList<GtObjectMemento>
+GtTaskRunner::sourceData(const QString& uuid, const GtObjectPath& path) const
+{
+    GtObject* obj = findSourceObject(uuid, path);
+
+    if (!obj)
+    {
+        return {};
+    }
+
+    gtDebug().medium() << tr("Fetching source data '%1'")
+                          .arg(obj->objectName());
+
+    QList<GtObjectMemento> retval{obj->toMemento()};
+
+    // parents are needed to add the object to the transferred data
+    for (const GtObject* p = obj->parentObject(); p && p != m_source.data();
+         p = p->parentObject())
+    {
+        retval.prepend(GtObjectMemento::propertiesOnly(*p));
+    }
+
+    return retval;
+}
+
 void
 GtTaskRunner::handleRunnableFinished()
 {
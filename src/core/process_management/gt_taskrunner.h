@@ -25,6 +25,7 @@ class GtAbstractRunnable;
 class GtProcessComponent;
 class GtObject;
 class GtObjectLinkProperty;
+class GtObjectPath;
 
 /**
  * @brief The GtTaskRunner class
@@ -52,6 +53,16 @@ public:
      */
     bool setUp(GtAbstractRunnable* runnable, GtObject* source);
 
+    /**
+     * @brief Sets whether only the source data referenced by the object links
+     * and object paths of the task is transferred to the runnable. Other
+     * source data is fetched on first access. Parents of referenced objects
+     * are transferred without their remaining children. Only the referenced
+     * and fetched objects are merged back. Must be called before setUp.
+     * @param val Whether to transfer only the linked source data
+     */
+    void setLinkedSourceDataOnly(bool val);
+
     /**
      * @brief Execution process.
      */
@@ -79,6 +90,9 @@ private:
     /// Map of all process components and their cloned counterpart
     QMap<GtProcessComponent*, GtProcessComponent*> m_componentMap;
 
+    /// Indicates whether only the linked source data is transferred
+    bool m_linkedDataOnly{false};
+
     /**
      * @brief cloneTask
      * @return
@@ -93,6 +107,39 @@ private:
      */
     bool setupElements(GtProcessComponent* orig, GtProcessComponent* cloned);
 
+    /**
+     * @brief Returns the source objects accessible by the task. Process data
+     * and label data are excluded.
+     * @return Accessible source objects
+     */
+    QList<GtObject*> sourceObjects() const;
+
+    /**
+     * @brief Searches the accessible source data for the given object.
+     * @param uuid Object uuid (may be empty)
+     * @param path Object path (used if uuid is empty)
+     * @return Source object. Null if not found.
+     */
+    GtObject* findSourceObject(const QString& uuid,
+                               const GtObjectPath& path) const;
+
+    /**
+     * @brief Transfers the source objects referenced by the task and all its
+     * process components to the runnable.
+     */
+    void appendLinkedSourceData();
+
+    /**
+     * @brief Returns the mementos of the requested source object and its
+     * parents, see GtAbstractRunnable::SourceDataProvider. Used to fetch
+     * source data on demand.
+     * @param uuid Object uuid (may be empty)
+     * @param path Object path (used if uuid is empty)
+     * @return Mementos of the parents and the object. Empty if not found.
+     */
+    QList<GtObjectMemento> sourceData(const QString& uuid,
+                                      const GtObjectPath& path) const;
+
 private slots:
     /**
      * @brief handleRunnableFinished
@@ -18,7 +18,6 @@
 #include "gt_processrunnercommandfactory.h"
 
 #include <QTcpSocket>
-#include <QRegularExpression>
 #include <QDomDocument>
 
 GtProcessRunnerTcpConnection::GtProcessRunnerTcpConnection(QObject* parent) :
@@ -44,7 +43,8 @@ void
 GtProcessRunnerTcpConnection::writeData(GtEventLoop& loop,
                                         const QByteArray& data)
 {
-    m_socket->write(loop, data, GtTcpSocket::PrependDataSize);
+    m_socket->write(loop, data, m_binaryFraming ? GtTcpSocket::BinaryFrame :
+                                                  GtTcpSocket::PrependDataSize);
 }
 
 void
@@ -61,6 +61,13 @@ GtProcessRunnerTcpConnection::connectTo(std::unique_ptr<QTcpSocket> socket)
     GtEventLoop loop{3 * 1000};
     m_socket->connectTo(loop, std::move(socket));
     loop.exec();
+
+    // announce that binary frames are understood. Peers not supporting
+    // binary frames will discard the hello message as unknown object
+    if (hasConnection())
+    {
+        m_socket->socket()->write(gt::tcp::helloMessage());
+    }
 }
 
 bool
@@ -76,75 +83,86 @@ GtProcessRunnerTcpConnection::close()
 }
 
 void
-GtProcessRunnerTcpConnection::onRead()
+GtProcessRunnerTcpConnection::setBinaryFraming(bool enable)
 {
-    static QRegularExpression regex{R"(^\d+)"};
-
-    m_buffer += m_socket->readAll();
-
-    if (m_buffer.isEmpty())
-    {
-        // all data must have been parsed successfully
-        return emit clearReadTimeout();
-    }
+    m_binaryFraming = enable;
+}
 
-    // fetch size of data
-    QRegularExpressionMatch match = regex.match(m_buffer);
+bool
+GtProcessRunnerTcpConnection::binaryFraming() const
+{
+    return m_binaryFraming;
+}
 
-    bool ok = false;
-    auto captured = match.captured();
-    int size = captured.toInt(&ok);
+void
+GtProcessRunnerTcpConnection::onRead()
+{
+    m_reader.append(m_socket->readAll());
 
-    if (!match.hasMatch() || !ok)
-    {
-        gtWarningId("TCP")
-                << tr("Failed to parse data!")
-                << gt::brackets(tr("Data size could not be parsed"));
-        return m_buffer.clear();
-    }
+    GtTcpFrameReader::Frame frame;
 
-    // read data
-    auto data = m_buffer.mid(captured.size(), size);
-    if (data.size() != size)
+    while (true)
     {
-        gtDebugId("TCP")
-                << tr("Incomplete data! (%1/%2)")
-                       .arg(data.size()).arg(size);
-        return;
+        auto status = m_reader.readFrame(frame);
+
+        if (status == GtTcpFrameReader::Incomplete)
+        {
+            break;
+        }
+
+        if (status == GtTcpFrameReader::Invalid)
+        {
+            gtWarningId("TCP")
+                    << tr("Failed to parse data!")
+                    << gt::brackets(tr("Invalid frame header"));
+            m_reader.clear();
+            break;
+        }
+
+        // the peer understands binary frames
+        if ((frame.binary || frame.type == gt::tcp::HelloFrame) &&
+            !m_binaryFraming)
+        {
+            gtDebugId("TCP") << tr("Using binary frames");
+            m_binaryFraming = true;
+        }
+
+        if (frame.type != gt::tcp::DataFrame)
+        {
+            continue;
+        }
+
+        QDomDocument doc;
+        QString errMsg;
+        int errRow = 0;
+        int errCol = 0;
+
+        // rudimental check if XML data is complete
+        if (!doc.setContent(frame.payload, &errMsg, &errRow, &errCol))
+        {
+            gtWarningId("TCP")
+                    << tr("Parsing error: row (%1) col (%2) error (%3)")
+                           .arg(errRow).arg(errCol).arg(errMsg);
+            qWarning().noquote() << "TCP: Data:\n" << frame.payload;
+            continue;
+        }
+
+        GtObjectMemento memento{doc.documentElement()};
+        GtObject* obj = memento.restore(&gtProcessRunnerCommandFactory);
+
+        queueData(std::unique_ptr<GtObject>(obj));
     }
 
-    // remove data from buffer
-    m_buffer.remove(0, captured.size() + size);
-
-    // data may not be complete yet
-    QDomDocument doc;
-    QString errMsg;
-    int errRow = 0;
-    int errCol = 0;
-
-    // rudimental check if XML data is complete
-    if (!doc.setContent(data, &errMsg, &errRow, &errCol))
+    if (m_reader.isEmpty())
     {
-        gtWarningId("TCP")
-                << tr("Parsing error: row (%1) col (%2) error (%3)")
-                       .arg(errRow).arg(errCol).arg(errMsg);
-        qWarning().noquote() << "TCP: Data:\n"   << data;
-        qWarning().noquote() << "TCP: Buffer:\n" << m_buffer;
-        return;
+        // all data must have been parsed successfully
+        emit clearReadTimeout();
     }
-
-    GtObjectMemento memento{doc.documentElement()};
-    GtObject* obj = memento.restore(&gtProcessRunnerCommandFactory);
-
-    queueData(std::unique_ptr<GtObject>(obj));
-
-    // parse pending commands in buffer
-    onRead();
 }
 
 void
 GtProcessRunnerTcpConnection::onReadTimeout()
 {
     gtErrorId("TCP") << tr("Reading incomplete data timed out!");
-    m_buffer.clear();
+    m_reader.clear();
 }
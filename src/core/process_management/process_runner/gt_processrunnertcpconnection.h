@@ -13,12 +13,19 @@
 
 #include "gt_processrunnerconnectionstrategy.h"
 #include "gt_tcpsocket.h"
+#include "gt_tcpframereader.h"
 
 #include <QTimer>
 
 /**
  * @brief The GtProcessRunnerTcpConnection class
- * TCP Connection strategy
+ * TCP Connection strategy.
+ *
+ * Data is written with its size as ascii prefix unless binary framing is
+ * used. The accepting side announces binary framing using a size prefixed
+ * hello message (see gt::tcp::helloMessage). Binary framing is used as soon
+ * as the hello message or a binary frame was received from the peer. Both
+ * formats are always accepted when reading.
  */
 class GT_CORE_EXPORT GtProcessRunnerTcpConnection :
         public GtProcessRunnerConnectionStrategy
@@ -55,6 +62,19 @@ public:
 
     void close() override;
 
+    /**
+     * @brief Sets whether data is written using binary frames. Should only
+     * be enabled if the peer is known to support binary frames.
+     * @param enable Whether to use binary frames
+     */
+    void setBinaryFraming(bool enable);
+
+    /**
+     * @brief Returns whether data is written using binary frames
+     * @return Whether binary frames are used
+     */
+    bool binaryFraming() const;
+
 protected:
 
     /**
@@ -74,7 +94,10 @@ private:
     QPointer<GtTcpSocket> m_socket;
 
     /// Buffer for reading incompleete packages
-    QByteArray m_buffer{};
+    GtTcpFrameReader m_reader;
+
+    /// Whether data is written using binary frames
+    bool m_binaryFraming{false};
 
     /// Timeout timer for reading incomplete packages
     QTimer m_readTimer;
@@ -76,6 +76,9 @@ struct GtSettings::Impl
 
     /// Whether to autostart the process runner
     GtSettingsItem* m_autostartProcessRunner;
+
+    /// Whether to store large lists binary
+    GtSettingsItem* m_storeBinaryLists;
 };
 
 GtSettings::GtSettings()
@@ -142,6 +145,9 @@ GtSettings::GtSettings()
 
     pimpl->m_autostartProcessRunner = registerSetting(
                 QStringLiteral("application/process_runner/autostart"), false);
+
+    pimpl->m_storeBinaryLists = registerSetting(
+                QStringLiteral("application/general/binaryLists"), false);
 }
 
 QList<GtShortCutSettingsData>
@@ -557,3 +563,15 @@ GtSettings::setAutostartProcessRunner(bool value)
 {
     return pimpl->m_autostartProcessRunner->setValue(value);
 }
+
+bool
+GtSettings::storeBinaryLists() const
+{
+    return pimpl->m_storeBinaryLists->getValue().toBool();
+}
+
+void
+GtSettings::setStoreBinaryLists(bool value)
+{
+    return pimpl->m_storeBinaryLists->setValue(value);
+}
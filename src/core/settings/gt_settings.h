@@ -377,6 +377,19 @@ public:
      */
     void setAutostartProcessRunner(bool value);
 
+    /**
+     * @brief Returns whether large double and int lists are stored binary
+     * (see gt::xml::setBinaryListThreshold)
+     * @return Whether binary lists are enabled
+     */
+    bool storeBinaryLists() const;
+
+    /**
+     * @brief Setter for storing large lists binary
+     * @param value Value
+     */
+    void setStoreBinaryLists(bool value);
+
 private:
 
     struct Impl;
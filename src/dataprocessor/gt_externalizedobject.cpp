@@ -57,9 +57,47 @@ GtExternalizedObject::setFetchInitialVersion(bool value) const
     pimpl->pFetchInitialVersion = value;
 }
 
+bool
+GtExternalizedObject::tracksModifications() const
+{
+    return pimpl->tracksModifications;
+}
+
+void
+GtExternalizedObject::enableModificationTracking()
+{
+    if (pimpl->tracksModifications)
+    {
+        return;
+    }
+
+    pimpl->tracksModifications = true;
+
+    // the internal properties are silent, all notified changes modify the
+    // object or its children
+    connect(this, qOverload<GtObject*>(&GtObject::dataChanged),
+            this, [this](GtObject*) { setDataModified(); });
+    connect(this, qOverload<GtObject*, GtAbstractProperty*>(
+                &GtObject::dataChanged),
+            this, [this](GtObject*, GtAbstractProperty*) {
+        setDataModified();
+    });
+}
+
+void
+GtExternalizedObject::setDataModified()
+{
+    pimpl->modified = true;
+}
+
 bool
 GtExternalizedObject::hasModifiedData()
 {
+    if (pimpl->tracksModifications)
+    {
+        return pimpl->modified || pimpl->pCachedHash.get().isEmpty();
+    }
+
     return hasModifiedData(calcExtHash());
 }
 
@@ -110,7 +148,8 @@ QString& GtExternalizedObject::extHash() const
 void
 GtExternalizedObject::onObjectDiffMerged()
 {
-    // nothing to do here
+    // the data may be changed by the diff
+    setDataModified();
     return GtObject::onObjectDiffMerged();
 }
 
@@ -163,6 +202,14 @@ GtExternalizedObject::fetchHelper()
 
     // set fetched flag
     pimpl->pFetched = true;
+
+    // the fetched data equals the externalized data. Modified data is not
+    // released, thus only the (saved) properties may have changed since
+    if (!pimpl->pCachedHash.get().isEmpty() && !pimpl->pFetchInitialVersion.get())
+    {
+        pimpl->modified = false;
+    }
+
     return true;
 }
 
@@ -225,6 +272,14 @@ GtExternalizedObject::externalize()
         return false;
     }
 
+    // unmodified objects are not hashed if modifications are tracked
+    if (pimpl->tracksModifications &&
+        !(pimpl->states & ExternalizeOnSave ||
+          pimpl->states & KeepInternalized || hasModifiedData()))
+    {
+        return true;
+    }
+
     // recalculate object hash
     QString hash{calcExtHash()};
 
@@ -232,13 +287,15 @@ GtExternalizedObject::externalize()
     if (!(pimpl->states & ExternalizeOnSave || pimpl->states & KeepInternalized ||
           hasModifiedData(hash)))
     {
+        pimpl->modified = false;
         return true;
     }
 
     gtDebug().medium() << "Externalizing object..." << gt::quoted(objectName());
 
-    // swap with old hash
-    hash.swap(pimpl->pCachedHash.get());
+    // update the hash using the setter, which invalidates the object hash
+    QString oldHash{pimpl->pCachedHash};
+    pimpl->pCachedHash = hash;
 
     // externalize
     if (!doExternalizeData(pimpl->pMetaData.get()))
@@ -246,11 +303,12 @@ GtExternalizedObject::externalize()
         gtError() << tr("Externalizing object failed!")
                   << tr("(Path: '%1')").arg(objectPath());
         // restore last hash
-        pimpl->pCachedHash = hash;
+        pimpl->pCachedHash = oldHash;
         return false;
     }
 
     // update states
+    pimpl->modified = false;
     pimpl->pFetchInitialVersion = false;
     pimpl->setExternalizeState(ExternalizeOnSave, false);
     pimpl->setExternalizeState(KeepInternalized, false);
@@ -305,3 +363,12 @@ GtExternalizedObjectData::isValid() const
 {
     return m_base != nullptr && m_base->isFetched() && m_base->isDataValid();
 }
+
+void
+GtExternalizedObjectData::setModified()
+{
+    if (m_base)
+    {
+        m_base->setDataModified();
+    }
+}
@@ -94,6 +94,12 @@ public:
 
 protected:
 
+    /**
+     * @brief Marks the data of the base object as modified. Should be called
+     * by all write accessors of the data class.
+     */
+    void setModified();
+
     /// pointer to base class
     QPointer<Base> m_base{};
 };
@@ -160,6 +166,13 @@ public:
      */
     QString const& extHash() const;
 
+    /**
+     * @brief Returns whether modifications are tracked explicitly (see
+     * enableModificationTracking)
+     * @return Whether modifications are tracked
+     */
+    bool tracksModifications() const;
+
 protected:
 
     /**
@@ -210,6 +223,23 @@ protected:
      */
     void onObjectDiffMerged() override;
 
+    /**
+     * @brief Tracks the modifications of the object explicitly instead of
+     * comparing the hash of the whole object including its data each time
+     * the data is released. Changes of properties and child objects are
+     * tracked automatically, changes of the externalized data must be marked
+     * using setDataModified (e.g. by the write accessors of the data class).
+     * The hash is only calculated when a modified object is externalized.
+     * Should be called in the constructor of the derived class.
+     */
+    void enableModificationTracking();
+
+    /**
+     * @brief Marks the externalized data as modified. Only used if
+     * modifications are tracked.
+     */
+    void setDataModified();
+
 private:
 
     std::unique_ptr<GtExternalizedObjectPrivate> pimpl;
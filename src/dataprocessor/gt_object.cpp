@@ -14,6 +14,8 @@
 #include "gt_logging.h"
 #include "gt_label.h"
 #include "gt_objectmementodiff.h"
+#include "gt_objectchangebatch.h"
+#include "gt_objectchangedispatcher.h"
 #include "gt_objectio.h"
 #include "gt_structproperty.h"
 #include "gt_propertystructcontainer.h"
@@ -21,12 +23,19 @@
 
 #include "gt_object.h"
 #include "gt_qtutilities.h"
+#include "gt_finally.h"
 
 #include <QUuid>
 #include <QSignalMapper>
 #include <QThread>
+#include <QChildEvent>
+#include <QMetaMethod>
+#include <QMultiHash>
+#include <QMutex>
+#include <QSet>
 
 #include <algorithm>
+#include <atomic>
 
 struct DummyData
 {
@@ -35,6 +44,95 @@ struct DummyData
     QString className;
 };
 
+namespace
+{
+
+/// whether directly emitted dataChanged signals are relayed to the parents
+std::atomic<bool> s_relayDirectDataChanges{false};
+
+/// object, whose change is delivered to its parents by notifyObservers
+thread_local GtObject const* s_notifyingObject{nullptr};
+
+} // namespace
+
+/**
+ * @brief Uuid of an object. Uuids in the string format of QUuid are stored
+ * as 128 bit value, any other uuid is stored as string.
+ */
+struct ObjectUuid
+{
+    QUuid id;
+
+    /// uuid not in the format of QUuid
+    QString custom;
+
+    static ObjectUuid create()
+    {
+        return {QUuid::createUuid(), {}};
+    }
+
+    static ObjectUuid fromString(const QString& str)
+    {
+        ObjectUuid retval;
+
+        // only uuids that are converted back to the same string
+        if (str.size() == 38 && str.at(0) == '{')
+        {
+            retval.id = QUuid::fromString(QStringView(str));
+        }
+
+        if (retval.id.isNull() || retval.id.toString() != str)
+        {
+            retval.id = QUuid();
+            retval.custom = str;
+        }
+
+        return retval;
+    }
+
+    bool isSet() const
+    {
+        return !id.isNull() || !custom.isEmpty();
+    }
+
+    QString toString() const
+    {
+        return id.isNull() ? custom : id.toString();
+    }
+
+    bool operator==(const ObjectUuid& other) const
+    {
+        return id == other.id && custom == other.custom;
+    }
+};
+
+/// Uuid to object lookup table shared by all objects of an indexed tree
+struct UuidIndex
+{
+    QMultiHash<QUuid, GtObject*> objects;
+
+    /// objects whose uuid is not in the format of QUuid
+    QMultiHash<QString, GtObject*> customObjects;
+
+    /// labels of the tree by their name
+    QMultiHash<QString, GtObject*> labels;
+
+    /// whether the objects of the tree are indexed by their classes
+    bool hasClassIndex{false};
+
+    /// objects of the tree by their class and all of its base classes
+    QHash<QMetaObject const*, QSet<GtObject*>> classes;
+
+    /// objects registered as plain GtObject. These may have been appended
+    /// while being constructed and are registered again once their final
+    /// class is known
+    QSet<GtObject*> unresolvedClasses;
+
+    /// guards the class index against concurrent queries, which resolve
+    /// the classes of the objects
+    QMutex classMutex;
+};
+
 struct GtObject::Impl
 {
     bool isDummy() const
@@ -65,8 +163,8 @@ struct GtObject::Impl
         memento.propertyContainers = dummyData.propertyContainers;
     }
 
-    /// Object specific uuid
-    QString uuid;
+    /// Object specific uuid. Generated on first access if not set
+    ObjectUuid uuid;
 
     /// Object flags
     GtObject::ObjectFlags objectFlags;
@@ -88,18 +186,461 @@ struct GtObject::Impl
     /// TODO: use a variant here
     DummyData dummyData;
 
+    /// uuid index of the tree this object belongs to (may be null)
+    std::shared_ptr<UuidIndex> uuidIndex;
+
+    /// whether the object owns an uuid index if it is not part of an
+    /// indexed tree
+    bool isUuidIndexRoot{false};
+
+    void registerUuid()
+    {
+        if (!uuidIndex)
+        {
+            return;
+        }
+
+        // indexed objects always have an uuid
+        if (!uuid.isSet())
+        {
+            uuid = ObjectUuid::create();
+        }
+
+        if (!uuid.id.isNull())
+        {
+            uuidIndex->objects.insert(uuid.id, self);
+        }
+        else
+        {
+            uuidIndex->customObjects.insert(uuid.custom, self);
+        }
+    }
+
+    void unregisterUuid()
+    {
+        if (!uuidIndex || !uuid.isSet())
+        {
+            return;
+        }
+
+        if (!uuid.id.isNull())
+        {
+            uuidIndex->objects.remove(uuid.id, self);
+        }
+        else
+        {
+            uuidIndex->customObjects.remove(uuid.custom, self);
+        }
+    }
+
+    /// name the object is registered with in the label index
+    QString labelName;
+
+    /// whether the object is registered in the label index
+    bool isIndexedLabel{false};
+
+    void registerLabel()
+    {
+        if (!uuidIndex || !qobject_cast<GtLabel*>(self))
+        {
+            return;
+        }
+
+        labelName = self->objectName();
+        uuidIndex->labels.insert(labelName, self);
+        isIndexedLabel = true;
+    }
+
+    void unregisterLabel()
+    {
+        if (!isIndexedLabel)
+        {
+            return;
+        }
+
+        if (uuidIndex)
+        {
+            uuidIndex->labels.remove(labelName, self);
+        }
+        isIndexedLabel = false;
+    }
+
+    /// class the object is registered with in the class index
+    QMetaObject const* indexedClass{nullptr};
+
+    /// whether the object owns a class index if it is not part of an
+    /// indexed tree
+    bool isClassIndexRoot{false};
+
+    void registerClass()
+    {
+        if (!uuidIndex || !uuidIndex->hasClassIndex)
+        {
+            return;
+        }
+
+        indexedClass = self->metaObject();
+
+        for (auto* meta = indexedClass; meta; meta = meta->superClass())
+        {
+            uuidIndex->classes[meta].insert(self);
+            if (meta == &GtObject::staticMetaObject) break;
+        }
+
+        if (indexedClass == &GtObject::staticMetaObject)
+        {
+            uuidIndex->unresolvedClasses.insert(self);
+        }
+    }
+
+    void unregisterClass()
+    {
+        if (!indexedClass)
+        {
+            return;
+        }
+
+        if (uuidIndex)
+        {
+            for (auto* meta = indexedClass; meta; meta = meta->superClass())
+            {
+                auto iter = uuidIndex->classes.find(meta);
+                if (iter != uuidIndex->classes.end())
+                {
+                    iter->remove(self);
+                    if (iter->isEmpty()) uuidIndex->classes.erase(iter);
+                }
+                if (meta == &GtObject::staticMetaObject) break;
+            }
+
+            uuidIndex->unresolvedClasses.remove(self);
+        }
+        indexedClass = nullptr;
+    }
+
+    /**
+     * @brief Registers all objects of the subtree in the class index.
+     * @param obj Root of the subtree
+     */
+    static void registerClasses(GtObject& obj)
+    {
+        obj.pimpl->unregisterClass();
+        obj.pimpl->registerClass();
+
+        for (GtObject* child : obj.findDirectChildren())
+        {
+            registerClasses(*child);
+        }
+    }
+
+    /**
+     * @brief Registers the objects, which were appended to the tree while
+     * being constructed, with their final class. Objects still being plain
+     * GtObjects stay unresolved and are checked again by the next query.
+     * The class mutex of the index must be locked.
+     * @param index Uuid index of the tree
+     */
+    static void resolveClasses(UuidIndex& index)
+    {
+        if (index.unresolvedClasses.isEmpty())
+        {
+            return;
+        }
+
+        // resolved objects are removed from the index while iterating
+        const QSet<GtObject*> unresolved = index.unresolvedClasses;
+
+        for (GtObject* obj : unresolved)
+        {
+            if (obj->metaObject() != &GtObject::staticMetaObject)
+            {
+                obj->pimpl->unregisterClass();
+                obj->pimpl->registerClass();
+            }
+        }
+    }
+
+    /// updates the label index once a label has been renamed
+    void updateLabelName()
+    {
+        if (isIndexedLabel && labelName != self->objectName())
+        {
+            unregisterLabel();
+            registerLabel();
+        }
+    }
+
+    /**
+     * @brief Registers the object and all of its descendants in the given
+     * uuid index and removes them from their previous index. Objects that
+     * are index roots receive their own index if the given index is null.
+     * @param obj Root of the subtree
+     * @param index New index. May be null to drop the subtree from indexing
+     */
+    static void attachToUuidIndex(GtObject& obj,
+                                  std::shared_ptr<UuidIndex> index)
+    {
+        Impl& d = *obj.pimpl;
+
+        if (!index && d.isUuidIndexRoot)
+        {
+            index = std::make_shared<UuidIndex>();
+            index->hasClassIndex = d.isClassIndexRoot;
+        }
+
+        // descendants always share the index of their parent, thus the
+        // subtree is already up to date
+        if (d.uuidIndex == index) return;
+
+        d.unregisterUuid();
+        d.unregisterLabel();
+        d.unregisterClass();
+        d.uuidIndex = index;
+        d.registerUuid();
+        d.registerLabel();
+        d.registerClass();
+
+        for (GtObject* child : obj.findDirectChildren())
+        {
+            attachToUuidIndex(*child, index);
+        }
+    }
+
+    /**
+     * @brief Looks up the object with the given uuid in the uuid index.
+     * Only objects below the given parent are taken into account.
+     * @param objectUUID Uuid to search for
+     * @param parent Parent object
+     * @param directChildrenOnly Whether only direct children of the parent
+     * should be considered
+     * @param ok Set to false if the uuid is ambiguous within the subtree
+     * @return Object found or nullptr
+     */
+    GtObject* findInUuidIndex(const ObjectUuid& objectUUID,
+                              GtObject const* parent,
+                              bool directChildrenOnly,
+                              bool& ok) const
+    {
+        assert(uuidIndex);
+
+        ok = true;
+
+        auto isDescendant = [parent, directChildrenOnly](QObject const* o) {
+            if (directChildrenOnly) return o->parent() == parent;
+
+            while ((o = o->parent()))
+            {
+                if (o == parent) return true;
+            }
+            return false;
+        };
+
+        auto find = [&](auto const& objects, auto const& key) {
+            GtObject* retval = nullptr;
+
+            auto iter = objects.constFind(key);
+            for (; iter != objects.constEnd() && iter.key() == key; ++iter)
+            {
+                if (!isDescendant(iter.value())) continue;
+
+                if (retval)
+                {
+                    // uuid is not unique
+                    ok = false;
+                    return static_cast<GtObject*>(nullptr);
+                }
+
+                retval = iter.value();
+            }
+
+            return retval;
+        };
+
+        if (!objectUUID.id.isNull())
+        {
+            return find(uuidIndex->objects, objectUUID.id);
+        }
+
+        return find(uuidIndex->customObjects, objectUUID.custom);
+    }
+
+    /// returns whether the object has the given uuid. Objects without an
+    /// uuid yet do not match any uuid
+    bool hasUuid(const ObjectUuid& objectUUID) const
+    {
+        return uuid.isSet() && uuid == objectUUID;
+    }
+
+    /// cached ordered list of direct child objects
+    QVector<GtObject*> childCache;
+
+    /// whether the child cache reflects the current children
+    bool childCacheValid{false};
+
+    /// whether the children are being reordered (see moveChildrenToEnd)
+    bool reorderingChildren{false};
+
+    /// whether the object is being moved to another parent of its index
+    bool movingWithinIndex{false};
+
+    /// position of the object in the child cache of its parent
+    int childIndex{-1};
+
+    /// cached hash of the own data of the object (null if not up to date)
+    QByteArray propertyHash;
+
+    /// cached hash of the object and its children (null if not up to date).
+    /// Only valid if the hashes of all children are valid as well.
+    QByteArray fullHash;
+
+    /**
+     * @brief Emits the data changed signal of the object or records the
+     * change if a change batch is active
+     * @param property Changed property (nullptr if the object changed)
+     */
+    void notifyDataChanged(GtAbstractProperty* property = nullptr)
+    {
+        if (GtObjectChangeBatch::record(*self, property)) return;
+
+        self->notifyObservers(property);
+    }
+
+    /**
+     * @brief Invalidates the cached hash of the object and its ancestors.
+     * @param ownData Whether the own data of the object changed
+     */
+    void invalidateHash(bool ownData)
+    {
+        if (ownData)
+        {
+            propertyHash.clear();
+        }
+
+        // the hashes of the ancestors of an object without hash are
+        // invalid already
+        for (Impl* d = this; d && !d->fullHash.isNull(); )
+        {
+            d->fullHash.clear();
+
+            GtObject* p = d->self->parentObject();
+            d = p ? p->pimpl.get() : nullptr;
+        }
+    }
+
+    /**
+     * @brief Invalidates the cached hash on changes of a silent property
+     * and its sub properties. The changes are not notified.
+     * @param property Silent property
+     */
+    void connectSilentProperty(GtAbstractProperty& property)
+    {
+        QObject::connect(&property, &GtAbstractProperty::changed, self,
+                         [this]() { invalidateHash(true); });
+
+        for (GtAbstractProperty* child : qAsConst(property.fullProperties()))
+        {
+            connectSilentProperty(*child);
+        }
+    }
+
+    /**
+     * @brief Returns the hash of the object and its children. Only the
+     * hashes of changed objects are recalculated.
+     * @param cacheable Set to whether the returned hash was cached
+     * @return Hash
+     */
+    QByteArray hash(bool& cacheable)
+    {
+        cacheable = true;
+
+        if (!fullHash.isNull())
+        {
+            return fullHash;
+        }
+
+        // changes of meta properties are not notified, hence the hashes of
+        // objects having meta properties are not cached
+        const QMetaObject* meta = self->metaObject();
+        bool ownCacheable = meta->propertyCount() <=
+                            QObject::staticMetaObject.propertyCount();
+
+        QByteArray ownHash = propertyHash;
+        if (ownHash.isNull())
+        {
+            GtObjectMemento memento = GtObjectMemento::propertiesOnly(*self);
+            memento.calculateHashes();
+            ownHash = memento.propertyHash();
+
+            if (ownCacheable) propertyHash = ownHash;
+        }
+
+        cacheable = ownCacheable;
+
+        auto const& children = childObjects();
+
+        QVector<QByteArray> childHashes;
+        childHashes.reserve(children.size());
+
+        for (GtObject* child : children)
+        {
+            bool childCacheable = true;
+            childHashes.push_back(child->pimpl->hash(childCacheable));
+            cacheable &= childCacheable;
+        }
+
+        QByteArray result = GtObjectMemento::combineHashes(ownHash,
+                                                           childHashes);
+        if (cacheable) fullHash = result;
+
+        return result;
+    }
+
+    void invalidateChildCache()
+    {
+        childCacheValid = false;
+    }
+
+    /**
+     * @brief Returns the direct child objects. The list is rebuilt only if
+     * children were inserted, removed or reordered since the last call.
+     * @return Ordered list of direct child objects
+     */
+    QVector<GtObject*> const& childObjects()
+    {
+        if (!childCacheValid)
+        {
+            childCache.clear();
+
+            for (QObject* c : self->children())
+            {
+                if (auto* child = qobject_cast<GtObject*>(c))
+                {
+                    child->pimpl->childIndex = childCache.size();
+                    childCache.push_back(child);
+                }
+            }
+
+            childCacheValid = true;
+        }
+
+        return childCache;
+    }
+
+    /// pointer to the object itself
+    GtObject* self{};
 };
 
 GtObject::GtObject(GtObject* parent) :
     pimpl(std::make_unique<Impl>())
 {
+    pimpl->self = this;
+
     if (parent)
     {
         parent->appendChild(this);
     }
 
-    // initialize uuid
-    newUuid();
+    // the uuid is generated on first access unless it is set before
 
     // set newly created flag
     setFlag(GtObject::NewlyCreated);
@@ -107,7 +648,32 @@ GtObject::GtObject(GtObject* parent) :
     connect(this, SIGNAL(objectNameChanged(QString)), SLOT(changed()));
 }
 
-GtObject::~GtObject() = default;
+GtObject::~GtObject()
+{
+    // children are unregistered by their own destructors
+    pimpl->unregisterUuid();
+    pimpl->unregisterLabel();
+    pimpl->unregisterClass();
+    pimpl->uuidIndex.reset();
+
+    if (GtObjectChangeBatch::isActive())
+    {
+        GtObjectChangeBatch::remove(*this);
+    }
+
+    if (GtObjectChangeDispatcher::hasSubscriptions())
+    {
+        GtObjectChangeDispatcher::remove(*this);
+    }
+
+    // the object is no GtObject anymore once the QObject destructor removes
+    // it from its parent
+    if (GtObject* p = parentObject())
+    {
+        p->pimpl->invalidateChildCache();
+        p->pimpl->invalidateHash(false);
+    }
+}
 
 GtObject::ObjectFlags
 GtObject::objectFlags() const
@@ -158,6 +724,8 @@ GtObject::fromMemento(const GtObjectMemento& memento)
         return;
     }
 
+    GtObjectChangeBatch batch;
+
     // merge data
     memento.mergeTo(*this, *pimpl->factory);
 }
@@ -165,12 +733,26 @@ GtObject::fromMemento(const GtObjectMemento& memento)
 bool
 GtObject::applyDiff(GtObjectMementoDiff& diff)
 {
+    GtObjectChangeBatch batch;
     return GtObjectIO::applyDiff(diff, this);
 }
 
+void
+GtObject::setRelayDirectDataChanges(bool enable)
+{
+    s_relayDirectDataChanges = enable;
+}
+
+bool
+GtObject::relayDirectDataChanges()
+{
+    return s_relayDirectDataChanges;
+}
+
 bool
 GtObject::revertDiff(GtObjectMementoDiff& diff)
 {
+    GtObjectChangeBatch batch;
     return GtObjectIO::revertDiff(diff, this);
 }
 
@@ -235,19 +817,33 @@ GtObject::appendChild(GtObject* c)
         return false;
     }
 
+    // the subtree keeps its index entries if it stays in the indexed tree
+    c->pimpl->movingWithinIndex =
+        pimpl->uuidIndex && c->pimpl->uuidIndex == pimpl->uuidIndex;
+
     c->disconnectFromParent();
     c->setParent(this);
 
-    connect(c, qOverload<GtObject*>(&GtObject::dataChanged),
-            this, qOverload<GtObject*>(&GtObject::dataChanged));
-    connect(c, qOverload<GtObject*, GtAbstractProperty*>(&GtObject::dataChanged),
-            this, qOverload<GtObject*, GtAbstractProperty*>(&GtObject::dataChanged));
+    c->pimpl->movingWithinIndex = false;
+
+    // data changes are delivered to the parents directly (notifyObservers)
     connect(c, &GtObject::childAppended,
             this, &GtObject::childAppended);
-    connect(c, qOverload<GtObject*, GtAbstractProperty*>(&GtObject::dataChanged),
-            this, &GtObject::onChildDataChanged);
-    connect(c, qOverload<GtObject*>(&GtObject::dataChanged),
-            this, &GtObject::onChildDataChanged);
+
+    if (s_relayDirectDataChanges)
+    {
+        // changes delivered by notifyObservers are not relayed twice
+        connect(c, qOverload<GtObject*>(&GtObject::dataChanged),
+                this, [this](GtObject* obj) {
+            if (s_notifyingObject != obj) emit dataChanged(obj);
+        });
+        connect(c, qOverload<GtObject*, GtAbstractProperty*>(
+                    &GtObject::dataChanged),
+                this, [this](GtObject* obj, GtAbstractProperty* prop) {
+            if (s_notifyingObject != obj) emit dataChanged(obj, prop);
+        });
+    }
+
     connect(c, &QObject::destroyed,
             this, &GtObject::changed);
 
@@ -269,30 +865,46 @@ GtObject::appendChildren(const QList<GtObject*>& list)
 void
 GtObject::disconnectFromParent()
 {
-    if (GtObject* p = parentObject())
+    GtObject* p = parentObject();
+
+    if (p)
     {
         // disconnect old signals and slots
-        disconnect(this, qOverload<GtObject*>(&GtObject::dataChanged),
-                   p, qOverload<GtObject*>(&GtObject::dataChanged));
-        disconnect(this, qOverload<GtObject*, GtAbstractProperty*>(&GtObject::dataChanged),
-                   p, qOverload<GtObject*, GtAbstractProperty*>(&GtObject::dataChanged));
         disconnect(this, &GtObject::childAppended,
                    p, &GtObject::childAppended);
-        disconnect(this, qOverload<GtObject*, GtAbstractProperty*>(&GtObject::dataChanged),
-                   p, &GtObject::onChildDataChanged);
-        disconnect(this, qOverload<GtObject*>(&GtObject::dataChanged),
-                   p, &GtObject::onChildDataChanged);
         disconnect(this, &QObject::destroyed,
                    p, &GtObject::changed);
+
+        // relay of directly emitted data changes (if enabled)
+        disconnect(this, qOverload<GtObject*>(&GtObject::dataChanged),
+                   p, nullptr);
+        disconnect(this, qOverload<GtObject*, GtAbstractProperty*>(
+                       &GtObject::dataChanged),
+                   p, nullptr);
     }
 
     setParent(nullptr);
+
+    // the old parent lost a child
+    if (p) p->changed();
 }
 
 QString
 GtObject::uuid() const
 {
-    return pimpl->uuid;
+    // objects of an indexed tree already have an uuid
+    if (!pimpl->uuid.isSet())
+    {
+        pimpl->uuid = ObjectUuid::create();
+    }
+
+    return pimpl->uuid.toString();
+}
+
+bool
+GtObject::hasUuid(const QString& val) const
+{
+    return pimpl->hasUuid(ObjectUuid::fromString(val));
 }
 
 void
@@ -303,13 +915,19 @@ GtObject::setUuid(const QString& val)
         return;
     }
 
-    pimpl->uuid = val;
+    pimpl->unregisterUuid();
+    pimpl->uuid = ObjectUuid::fromString(val);
+    pimpl->registerUuid();
+    pimpl->invalidateHash(true);
 }
 
 void
 GtObject::newUuid(bool renewChildUUIDs)
 {
-    pimpl->uuid = QUuid::createUuid().toString();
+    pimpl->unregisterUuid();
+    pimpl->uuid = ObjectUuid::create();
+    pimpl->registerUuid();
+    pimpl->invalidateHash(true);
 
     if (renewChildUUIDs)
     {
@@ -320,10 +938,14 @@ GtObject::newUuid(bool renewChildUUIDs)
 QString
 GtObject::calcHash() const
 {
-    GtObjectMemento mem = toMemento();
-    mem.calculateHashes();
+    return contentHash().toHex();
+}
 
-    return mem.fullHash().toHex();
+QByteArray
+GtObject::contentHash() const
+{
+    bool cacheable = true;
+    return pimpl->hash(cacheable);
 }
 
 bool
@@ -385,12 +1007,32 @@ GtObject::childNumber() const
 
     if (p)
     {
-        return p->findDirectChildren().indexOf(this);
+        auto const& siblings = p->pimpl->childObjects();
+        int const idx = pimpl->childIndex;
+
+        if (siblings.value(idx) == this)
+        {
+            return idx;
+        }
+
+        return siblings.indexOf(const_cast<GtObject*>(this));
     }
 
     return -1;
 }
 
+QVector<GtObject*> const&
+GtObject::childObjects()
+{
+    return pimpl->childObjects();
+}
+
+QVector<GtObject const*> const&
+GtObject::childObjects() const
+{
+    return gt::container_const_cast(pimpl->childObjects());
+}
+
 QObject*
 GtObject::parent()
 {
@@ -469,6 +1111,13 @@ GtObject::acceptChangesRecursively()
     }
 }
 
+void
+GtObject::notifyDataChanged(GtAbstractProperty* property)
+{
+    pimpl->invalidateHash(true);
+    pimpl->notifyDataChanged(property);
+}
+
 void
 GtObject::debugObjectTree(int indent)
 {
@@ -623,8 +1272,10 @@ GtObject::propertyContainers() const
 void
 GtObject::changed()
 {
+    pimpl->updateLabelName();
+    pimpl->invalidateHash(true);
     setFlag(GtObject::HasOwnChanges);
-    emit dataChanged(this);
+    pimpl->notifyDataChanged();
 }
 
 QString
@@ -722,12 +1373,27 @@ GtObject::onChildDataChanged()
 GtObject*
 GtObject::getObjectByUuid(const QString& objectUUID)
 {
-    if (uuid() == objectUUID)
+    ObjectUuid const key = ObjectUuid::fromString(objectUUID);
+
+    if (pimpl->hasUuid(key))
     {
         return this;
     }
 
-    return gt::findObject(objectUUID, findChildren());
+    if (pimpl->uuidIndex)
+    {
+        bool ok = true;
+        GtObject* obj = pimpl->findInUuidIndex(key, this, false, ok);
+
+        if (ok) return obj;
+    }
+
+    for (GtObject* child : findChildren())
+    {
+        if (child->pimpl->hasUuid(key)) return child;
+    }
+
+    return nullptr;
 }
 
 const GtObject*
@@ -739,7 +1405,22 @@ GtObject::getObjectByUuid(const QString& objectUUID) const
 GtObject*
 GtObject::getDirectChildByUuid(const QString& objectUUID)
 {
-    return gt::findObject(objectUUID, findDirectChildren());
+    ObjectUuid const key = ObjectUuid::fromString(objectUUID);
+
+    if (pimpl->uuidIndex)
+    {
+        bool ok = true;
+        GtObject* obj = pimpl->findInUuidIndex(key, this, true, ok);
+
+        if (ok) return obj;
+    }
+
+    for (GtObject* child : childObjects())
+    {
+        if (child->pimpl->hasUuid(key)) return child;
+    }
+
+    return nullptr;
 }
 
 const GtObject*
@@ -748,6 +1429,148 @@ GtObject::getDirectChildByUuid(const QString& objectUUID) const
     return const_cast<GtObject*>(this)->getDirectChildByUuid(objectUUID);
 }
 
+void
+GtObject::enableUuidIndex()
+{
+    if (pimpl->isUuidIndexRoot)
+    {
+        return;
+    }
+
+    pimpl->isUuidIndexRoot = true;
+
+    // objects within an indexed tree share the index of the tree
+    if (!pimpl->uuidIndex)
+    {
+        Impl::attachToUuidIndex(*this, std::make_shared<UuidIndex>());
+    }
+}
+
+bool
+GtObject::hasUuidIndex() const
+{
+    return pimpl->uuidIndex != nullptr;
+}
+
+void
+GtObject::enableClassIndex()
+{
+    if (pimpl->isClassIndexRoot)
+    {
+        return;
+    }
+
+    pimpl->isClassIndexRoot = true;
+
+    enableUuidIndex();
+
+    auto& index = *pimpl->uuidIndex;
+    if (index.hasClassIndex)
+    {
+        return;
+    }
+
+    // the class index covers the whole indexed tree
+    GtObject* root = this;
+    while (GtObject* p = root->parentObject())
+    {
+        if (p->pimpl->uuidIndex != pimpl->uuidIndex) break;
+        root = p;
+    }
+
+    index.hasClassIndex = true;
+    Impl::registerClasses(*root);
+}
+
+bool
+GtObject::hasClassIndex() const
+{
+    return pimpl->uuidIndex && pimpl->uuidIndex->hasClassIndex;
+}
+
+bool
+GtObject::findIndexedDescendants(const QMetaObject& meta,
+                                 QList<GtObject*>& objects) const
+{
+    if (!hasClassIndex())
+    {
+        return false;
+    }
+
+    auto& index = *pimpl->uuidIndex;
+
+    // const queries may run concurrently
+    QMutexLocker locker(&index.classMutex);
+    Impl::resolveClasses(index);
+
+    auto iter = index.classes.constFind(&meta);
+    if (iter == index.classes.constEnd())
+    {
+        return true;
+    }
+
+    // all objects of the tree are descendants of its root
+    GtObject const* p = parentObject();
+    bool isRoot = !p || p->pimpl->uuidIndex != pimpl->uuidIndex;
+
+    auto isDescendant = [this](QObject const* o) {
+        while ((o = o->parent()))
+        {
+            if (o == this) return true;
+        }
+        return false;
+    };
+
+    objects.reserve(isRoot ? iter->size() : 0);
+
+    for (GtObject* obj : *iter)
+    {
+        if (isRoot ? obj != this : isDescendant(obj))
+        {
+            objects.append(obj);
+        }
+    }
+
+    return true;
+}
+
+QList<GtLabel*>
+GtObject::findLabels(const QString& name) const
+{
+    QList<GtLabel*> retval;
+
+    if (!pimpl->uuidIndex)
+    {
+        auto* self = const_cast<GtObject*>(this);
+        for (GtLabel* label : self->findChildren<GtLabel*>())
+        {
+            if (label->objectName() == name) retval.append(label);
+        }
+
+        return retval;
+    }
+
+    auto isDescendant = [this](QObject const* o) {
+        while ((o = o->parent()))
+        {
+            if (o == this) return true;
+        }
+        return false;
+    };
+
+    auto iter = pimpl->uuidIndex->labels.constFind(name);
+    for (; iter != pimpl->uuidIndex->labels.constEnd() &&
+           iter.key() == name; ++iter)
+    {
+        if (isDescendant(iter.value()))
+        {
+            retval.append(static_cast<GtLabel*>(iter.value()));
+        }
+    }
+
+    return retval;
+}
+
 GtObject*
 GtObject::getObjectByPath(const QString& objectPath)
 {
@@ -766,8 +1589,9 @@ GtObject::connectProperty(GtAbstractProperty& property)
 {
     connect(&property, &GtAbstractProperty::changed, this,
             [this, p = &property]() {
+        pimpl->invalidateHash(true);
         setFlag(GtObject::HasOwnChanges, true);
-        emit dataChanged(this, p);
+        pimpl->notifyDataChanged(p);
     });
 
     for (GtAbstractProperty* child : qAsConst(property.fullProperties()))
@@ -776,6 +1600,75 @@ GtObject::connectProperty(GtAbstractProperty& property)
     }
 }
 
+void
+GtObject::notifyObservers(GtAbstractProperty* property)
+{
+    static QMetaMethod const objectSignal =
+        QMetaMethod::fromSignal(qOverload<GtObject*>(&GtObject::dataChanged));
+    static QMetaMethod const propertySignal =
+        QMetaMethod::fromSignal(qOverload<GtObject*, GtAbstractProperty*>(
+                                    &GtObject::dataChanged));
+
+    GtObject const* notifying = s_notifyingObject;
+    s_notifyingObject = this;
+    auto restore = gt::finally([notifying]() {
+        s_notifyingObject = notifying;
+    });
+    Q_UNUSED(restore)
+
+    if (property)
+    {
+        emit dataChanged(this, property);
+    }
+    else
+    {
+        emit dataChanged(this);
+    }
+
+    bool const dispatch = GtObjectChangeDispatcher::hasSubscriptions();
+
+    if (dispatch)
+    {
+        GtObjectChangeDispatcher::dispatch(*this, this, property);
+    }
+
+    for (GtObject* p = parentObject(); p; p = p->parentObject())
+    {
+        p->setFlag(GtObject::HasChildChanges);
+
+        if (property && p->isSignalConnected(propertySignal))
+        {
+            emit p->dataChanged(this, property);
+        }
+        else if (!property && p->isSignalConnected(objectSignal))
+        {
+            emit p->dataChanged(this);
+        }
+
+        if (dispatch)
+        {
+            GtObjectChangeDispatcher::dispatch(*p, this, property);
+        }
+    }
+}
+
+void
+GtObject::moveChildrenToEnd(const QList<GtObject*>& children)
+{
+    // QObject does not allow reordering the children, hence the children
+    // are removed and added again
+    pimpl->reorderingChildren = true;
+
+    for (GtObject* child : children)
+    {
+        assert(child->parent() == this);
+        child->setParent(nullptr);
+        child->setParent(this);
+    }
+
+    pimpl->reorderingChildren = false;
+}
+
 void
 GtObject::fullPropertyListHelper(GtAbstractProperty* p,
                                  QList<GtAbstractProperty*>& list) const
@@ -816,6 +1709,7 @@ void
 GtObject::importMementoIntoDummy(const GtObjectMemento& memento)
 {
     pimpl->importDummy(memento);
+    pimpl->invalidateHash(true);
 }
 
 void
@@ -868,20 +1762,23 @@ GtObject::registerPropertyStructContainer(GtPropertyStructContainer & c)
 
     connect(&c, &GtPropertyStructContainer::entryChanged, this,
             [this](int, GtAbstractProperty* property) {
+        pimpl->invalidateHash(true);
         setFlag(GtObject::HasOwnChanges, true);
-        emit dataChanged(this, property);
+        pimpl->notifyDataChanged(property);
     });
 
     connect(&c, &GtPropertyStructContainer::entryAdded, this,
             [this](int) {
+        pimpl->invalidateHash(true);
         setFlag(GtObject::HasOwnChanges, true);
-        emit dataChanged(this);
+        pimpl->notifyDataChanged();
     });
 
     connect(&c, &GtPropertyStructContainer::entryRemoved, this,
             [this](int) {
+        pimpl->invalidateHash(true);
         setFlag(GtObject::HasOwnChanges, true);
-        emit dataChanged(this);
+        pimpl->notifyDataChanged();
     });
 
     return true;
@@ -908,6 +1805,9 @@ GtObject::registerSilentProperty(GtAbstractProperty& property)
         return false;
     }
 
+    // silent properties are part of the hash
+    pimpl->connectSilentProperty(property);
+
     pimpl->properties.append(&property);
     return true;
 }
@@ -939,6 +1839,44 @@ GtObject::childAccepted(GtObject* /*child*/)
     return true;
 }
 
+void
+GtObject::childEvent(QChildEvent* event)
+{
+    QObject::childEvent(event);
+
+    if (event->added() || event->removed())
+    {
+        pimpl->invalidateChildCache();
+        pimpl->invalidateHash(false);
+    }
+
+    // children that are being destroyed are no GtObjects anymore and have
+    // already been removed from the index
+    auto* child = qobject_cast<GtObject*>(event->child());
+    if (!child) return;
+
+    // reordered children stay in the tree
+    if (pimpl->reorderingChildren) return;
+
+    if (event->added())
+    {
+        if (pimpl->uuidIndex)
+        {
+            Impl::attachToUuidIndex(*child, pimpl->uuidIndex);
+        }
+    }
+    else if (event->removed())
+    {
+        if (child->pimpl->uuidIndex && !child->pimpl->movingWithinIndex)
+        {
+            Impl::attachToUuidIndex(*child, nullptr);
+        }
+
+        // moving a child to another parent changes this object as well
+        setFlag(GtObject::HasOwnChanges);
+    }
+}
+
 bool
 gt::isDerivedFromClass(GtObject* obj, const QString& superClassName)
 {
@@ -15,6 +15,7 @@
 #include "gt_typetraits.h"
 
 #include <QObject>
+#include <QVector>
 
 #include <algorithm>
 #include <memory>
@@ -25,6 +26,7 @@ class GtAbstractProperty;
 class GtObjectIO;
 class GtObjectMementoDiff;
 class GtPropertyStructContainer;
+class GtLabel;
 
 #define GT_CLASSNAME(A) A::staticMetaObject.className()
 #define GT_METADATA(A) A::staticMetaObject
@@ -81,6 +83,7 @@ class GT_DATAMODEL_EXPORT GtObject : public QObject
 
     friend class GtObjectIO;
     friend class GtObjectMemento;
+    friend class GtObjectChangeBatch;
 
 public:
     /// Flags to describe objects state and otions
@@ -107,8 +110,9 @@ public:
 
     /**
      * @brief GtObject
-     * Constructor sets basic flag for newly creation, sets a new uuid
-     * for the object and sets the parent.
+     * Constructor sets basic flag for newly creation and sets the parent.
+     * The uuid of the object is generated on first access unless it is
+     * set before.
      * @param parent is the object in the hierarchy of the datamodel which is
      * the level over the object and its owner. If the parent is deleted the
      * object is deleted aswell.
@@ -228,6 +232,14 @@ public:
      */
     QString uuid() const;
 
+    /**
+     * @brief Returns whether the object has the given uuid. In contrast to
+     * comparing with uuid(), no uuid is generated and converted to a string.
+     * @param val Uuid to compare with
+     * @return Whether the uuids are equal
+     */
+    bool hasUuid(const QString& val) const;
+
     /**
      * @brief Sets new uuid for object.
      * @param val - new uuid to use
@@ -247,6 +259,15 @@ public:
      */
     QString calcHash() const;
 
+    /**
+     * @brief Returns the hash of the object including its children. The
+     * hash equals the full hash of the memento of the object. Hashes are
+     * cached and recalculated only for objects that changed since the last
+     * call.
+     * @return Object hash
+     */
+    QByteArray contentHash() const;
+
     /**
      * @brief Returns true if is default flag is active. Otherwise false is
      * returned.
@@ -300,6 +321,15 @@ public:
      */
     int childNumber() const;
 
+    /**
+     * @brief Returns the ordered list of direct child objects. The list is
+     * cached and only rebuilt if children were inserted, removed or
+     * reordered. Thus, repeated access (e.g. by item models) is cheap.
+     * @return Direct child objects
+     */
+    QVector<GtObject*> const& childObjects();
+    QVector<GtObject const*> const& childObjects() const;
+
     /**
      * @brief Reimplemented from QObject. Returns the parent with const
      * correctness
@@ -351,6 +381,33 @@ public:
      */
     void acceptChangesRecursively();
 
+    /**
+     * @brief Notifies the observers of the object, its parents and the
+     * subscribers of the change dispatcher about a change, which was not
+     * signaled by a property. The cached hash is invalidated, the change
+     * flags are not set. Must be used instead of emitting dataChanged
+     * directly, which only reaches the receivers connected to the object.
+     * @param property Changed property (nullptr if the object changed)
+     */
+    void notifyDataChanged(GtAbstractProperty* property = nullptr);
+
+    /**
+     * @brief Sets whether dataChanged signals, which are emitted directly
+     * instead of using notifyDataChanged, are relayed to the parents as in
+     * earlier versions. Compatibility switch for modules emitting the
+     * signals directly, disabled by default. Only affects children, which
+     * are appended afterwards, hence it should be set on startup.
+     * @param enable Whether to relay directly emitted changes
+     */
+    static void setRelayDirectDataChanges(bool enable);
+
+    /**
+     * @brief Returns whether directly emitted dataChanged signals are
+     * relayed to the parents
+     * @return Whether directly emitted changes are relayed
+     */
+    static bool relayDirectDataChanges();
+
     /**
      * @brief debugObjectTree
      * @param indent
@@ -511,6 +568,61 @@ public:
         return QObject::findChildren<T_const_ptr>(name, Qt::FindChildrenRecursively);
     }
 
+    /**
+     * @brief Returns all descendants of the template class. Within a tree
+     * with a class index (see enableClassIndex) the objects are looked up
+     * in the index and the order of the list is unspecified. Otherwise the
+     * subtree is searched using findChildren.
+     * @return returns list of pointers to descendants of the template class
+     */
+    template <typename T = GtObject*,
+              gt::trait::enable_if_ptr_derived_of_qobject<T> = true>
+    QList<T> findDescendants()
+    {
+        using Class = std::remove_pointer_t<T>;
+        static_assert(std::is_base_of<GtObject, Class>::value,
+                      "T must be derived of GtObject");
+
+        QList<GtObject*> objects;
+        if (!findIndexedDescendants(Class::staticMetaObject, objects))
+        {
+            return findChildren<T>();
+        }
+
+        QList<T> retval;
+        retval.reserve(objects.size());
+        for (GtObject* obj : qAsConst(objects))
+        {
+            retval.append(static_cast<T>(obj));
+        }
+
+        return retval;
+    }
+    template <typename T = GtObject*,
+              typename T_const_ptr = gt::trait::const_ptr<T>,
+              gt::trait::enable_if_ptr_derived_of_qobject<T> = true>
+    QList<T_const_ptr> findDescendants() const
+    {
+        using Class = std::remove_pointer_t<T>;
+        static_assert(std::is_base_of<GtObject, Class>::value,
+                      "T must be derived of GtObject");
+
+        QList<GtObject*> objects;
+        if (!findIndexedDescendants(Class::staticMetaObject, objects))
+        {
+            return findChildren<T>();
+        }
+
+        QList<T_const_ptr> retval;
+        retval.reserve(objects.size());
+        for (GtObject const* obj : qAsConst(objects))
+        {
+            retval.append(static_cast<T_const_ptr>(obj));
+        }
+
+        return retval;
+    }
+
     /**
      * @brief findDirectChild
      * @param name - optional string to search child with given name
@@ -577,20 +689,16 @@ public:
             return appendChild(obj);
         }
 
-        QList<T> elementsBehindPos;
+        QList<GtObject*> elementsBehindPos;
 
         for (int i = pos; i < list.size(); ++i)
         {
             elementsBehindPos.append(list.at(i));
-            list.at(i)->setParent(nullptr);
         }
 
         appendChild(obj);
 
-        for (T element : elementsBehindPos)
-        {
-            element->setParent(this);
-        }
+        moveChildrenToEnd(elementsBehindPos);
 
         return true;
     }
@@ -615,6 +723,51 @@ public:
     GtObject* getDirectChildByUuid(const QString& objectUUID);
     GtObject const* getDirectChildByUuid(const QString& objectUUID) const;
 
+    /**
+     * @brief Enables the uuid index for this object. The index maps the
+     * uuids of the object and all of its descendants to the objects and is
+     * updated incrementally if children are appended, reparented or deleted
+     * or if an uuid changes. Thus, getObjectByUuid and getDirectChildByUuid
+     * no longer have to scan the subtree. If the object is appended to an
+     * indexed tree, it shares the index of that tree.
+     * Should be used for top level objects such as the session, projects or
+     * the data of a runnable.
+     */
+    void enableUuidIndex();
+
+    /**
+     * @brief Returns whether the object is part of a tree with an uuid index
+     * @return Whether uuid lookups are resolved using an index
+     */
+    bool hasUuidIndex() const;
+
+    /**
+     * @brief Enables the class index for the tree of this object. The index
+     * maps the classes of all objects of the tree, including their base
+     * classes, to the objects and is updated incrementally if objects are
+     * appended, reparented or deleted. Thus, findDescendants only visits
+     * the objects found instead of the whole subtree. Enables the uuid
+     * index as well (see enableUuidIndex).
+     * Should be used for large trees such as projects.
+     */
+    void enableClassIndex();
+
+    /**
+     * @brief Returns whether the object is part of a tree with a class index
+     * @return Whether typed descendant queries are resolved using an index
+     */
+    bool hasClassIndex() const;
+
+    /**
+     * @brief Returns all labels below this object with the given name.
+     * Within a tree with an uuid index (see enableUuidIndex) the labels are
+     * looked up in a label index, which is updated if labels are appended,
+     * removed or renamed. Otherwise the subtree is searched.
+     * @param name Label name
+     * @return Labels found
+     */
+    QList<GtLabel*> findLabels(const QString& name) const;
+
     /**
      * @brief getObjectByPath
      * @param objectPath
@@ -698,6 +851,13 @@ protected:
      */
     virtual bool childAccepted(GtObject* child);
 
+    /**
+     * @brief Reimplemented from QObject. Keeps the uuid index up to date if
+     * children are added or removed.
+     * @param event Child event
+     */
+    void childEvent(QChildEvent* event) override;
+
 protected slots:
     /**
      * @brief changed
@@ -715,6 +875,15 @@ private:
      */
     QString objectPath(QString& str) const;
 
+    /**
+     * @brief Looks up all descendants of the given class in the class index
+     * @param meta Meta object of the class
+     * @param objects Descendants found
+     * @return Whether the object is part of a tree with a class index
+     */
+    bool findIndexedDescendants(const QMetaObject& meta,
+                                QList<GtObject*>& objects) const;
+
     /**
      * @brief Connects the property changed singal to the data changed signal
      * of this object
@@ -722,6 +891,22 @@ private:
      */
     void connectProperty(GtAbstractProperty& property);
 
+    /**
+     * @brief Moves the children behind all other children. The children stay
+     * in this tree, thus the indices of the tree are not updated.
+     * @param children Direct children to move
+     */
+    void moveChildrenToEnd(const QList<GtObject*>& children);
+
+    /**
+     * @brief Emits the data changed signals of the object and delivers the
+     * change to its parents: the parents are marked as having child changes,
+     * their data changed signals are emitted if connected and their
+     * subscribers of the change dispatcher are called.
+     * @param property Changed property (nullptr if the object changed)
+     */
+    void notifyObservers(GtAbstractProperty* property);
+
     /**
      * @brief fullPropertyListHelper
      * @param p
@@ -767,12 +952,16 @@ private slots:
 
 signals:
     /**
-     * @brief dataChanged
+     * @brief dataChanged. Use notifyDataChanged to notify a change, emitting
+     * the signal directly does not reach the parents
+     * (see setRelayDirectDataChanges).
      */
     void dataChanged(GtObject*);
 
     /**
-     * @brief dataChanged
+     * @brief dataChanged. Use notifyDataChanged to notify a change, emitting
+     * the signal directly does not reach the parents
+     * (see setRelayDirectDataChanges).
      */
     void dataChanged(GtObject*, GtAbstractProperty*);
 
@@ -844,7 +1033,7 @@ findObject(const QString& objectUUID, const List& list)
 {
     auto iter = std::find_if(std::begin(list), std::end(list),
                              [&objectUUID](const GtObject* obj) {
-        return obj->uuid() == objectUUID;
+        return obj->hasUuid(objectUUID);
     });
 
     return iter != std::end(list) ? *iter : nullptr;
@@ -0,0 +1,151 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_objectchangebatch.h"
+
+#include "gt_object.h"
+#include "gt_abstractproperty.h"
+
+#include <QHash>
+#include <QPointer>
+#include <QSet>
+#include <QVector>
+
+#include <vector>
+
+namespace
+{
+
+/// Changes of an object collected by a batch
+struct Changes
+{
+    QPointer<GtObject> object;
+
+    /// whether the object itself changed
+    bool objectChanged{false};
+
+    /// changed properties in the order of their first change
+    QVector<QPointer<GtAbstractProperty>> properties;
+};
+
+/// Batch state of a thread
+struct BatchState
+{
+    /// number of open scopes
+    int depth{0};
+
+    /// changes in the order of the first change of each object
+    std::vector<Changes> changes;
+
+    /// index of the changes of each object
+    QHash<const GtObject*, int> indices;
+
+    /// recorded properties by the index of the changes of their object
+    QSet<QPair<int, const GtAbstractProperty*>> properties;
+};
+
+BatchState&
+batchState()
+{
+    static thread_local BatchState state;
+    return state;
+}
+
+} // namespace
+
+GtObjectChangeBatch::GtObjectChangeBatch()
+{
+    ++batchState().depth;
+}
+
+GtObjectChangeBatch::~GtObjectChangeBatch()
+{
+    if (--batchState().depth == 0)
+    {
+        flush();
+    }
+}
+
+bool
+GtObjectChangeBatch::isActive()
+{
+    return batchState().depth > 0;
+}
+
+void
+GtObjectChangeBatch::flush()
+{
+    BatchState& state = batchState();
+
+    // changes made by receivers are recorded again or emitted directly
+    std::vector<Changes> changes;
+    changes.swap(state.changes);
+    state.indices.clear();
+    state.properties.clear();
+
+    for (Changes const& c : changes)
+    {
+        if (!c.object) continue;
+
+        // a single changed property is notified as such, all other changes
+        // of the object are summarized by one notification
+        if (!c.objectChanged && c.properties.size() == 1 &&
+            c.properties.first())
+        {
+            c.object->notifyObservers(c.properties.first());
+        }
+        else
+        {
+            c.object->notifyObservers(nullptr);
+        }
+    }
+}
+
+bool
+GtObjectChangeBatch::record(GtObject& obj, GtAbstractProperty* property)
+{
+    BatchState& state = batchState();
+
+    if (state.depth == 0)
+    {
+        return false;
+    }
+
+    auto iter = state.indices.constFind(&obj);
+    if (iter == state.indices.constEnd())
+    {
+        iter = state.indices.insert(&obj, static_cast<int>(state.changes.size()));
+        state.changes.push_back(Changes{&obj, false, {}});
+    }
+
+    Changes& c = state.changes[iter.value()];
+
+    if (!property)
+    {
+        c.objectChanged = true;
+    }
+    else
+    {
+        QPair<int, const GtAbstractProperty*> key{iter.value(), property};
+
+        if (!state.properties.contains(key))
+        {
+            state.properties.insert(key);
+            c.properties.append(property);
+        }
+    }
+
+    return true;
+}
+
+void
+GtObjectChangeBatch::remove(GtObject& obj)
+{
+    BatchState& state = batchState();
+
+    // the changes are skipped as the object pointer is cleared
+    state.indices.remove(&obj);
+}
@@ -0,0 +1,78 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTOBJECTCHANGEBATCH_H
+#define GTOBJECTCHANGEBATCH_H
+
+#include "gt_datamodel_exports.h"
+
+class GtObject;
+class GtAbstractProperty;
+
+/**
+ * @brief Scope, in which the `dataChanged` signals of all objects of the
+ * current thread are collected instead of being emitted. If the scope is
+ * closed, each changed object emits one notification in the order of the
+ * first change: `dataChanged(GtObject*, GtAbstractProperty*)` if only a
+ * single property changed, `dataChanged(GtObject*)` otherwise.
+ *
+ * Flags and hashes of the objects are updated immediately. Scopes can be
+ * nested, the notifications are emitted if the outermost scope is closed.
+ *
+ * Usage:
+ *
+ * {
+ *     GtObjectChangeBatch batch;
+ *
+ *     for (GtAbstractProperty* p : obj.properties())
+ *     {
+ *         p->setValueFromVariant(...);
+ *     }
+ * } // obj emits dataChanged once
+ */
+class GT_DATAMODEL_EXPORT GtObjectChangeBatch
+{
+public:
+    GtObjectChangeBatch();
+    ~GtObjectChangeBatch();
+
+    GtObjectChangeBatch(const GtObjectChangeBatch&) = delete;
+    GtObjectChangeBatch& operator=(const GtObjectChangeBatch&) = delete;
+
+    /**
+     * @brief Returns whether a batch is active in the current thread
+     * @return Whether a batch is active
+     */
+    static bool isActive();
+
+    /**
+     * @brief Emits all notifications collected in the current thread so far.
+     * The batch stays active. Used by code, which relies on the signals
+     * being emitted, e.g. before creating the diff of a command.
+     */
+    static void flush();
+
+private:
+    friend class GtObject;
+
+    /**
+     * @brief Records a change of the object if a batch is active
+     * @param obj Changed object
+     * @param property Changed property (nullptr if the object changed)
+     * @return Whether the change was recorded. Otherwise the signal has to
+     * be emitted by the object
+     */
+    static bool record(GtObject& obj, GtAbstractProperty* property);
+
+    /**
+     * @brief Removes all recorded changes of the object. Called if the
+     * object is destroyed
+     * @param obj Object
+     */
+    static void remove(GtObject& obj);
+};
+
+#endif // GTOBJECTCHANGEBATCH_H
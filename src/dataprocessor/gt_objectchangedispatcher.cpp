@@ -0,0 +1,158 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_objectchangedispatcher.h"
+
+#include "gt_object.h"
+
+#include <QHash>
+#include <QVector>
+
+#include <algorithm>
+
+namespace
+{
+
+struct Subscriber
+{
+    quint64 id;
+    GtObjectChangeDispatcher::Callback callback;
+    GtObjectChangeDispatcher::Filter filter;
+};
+
+/// Subscriptions of a thread
+struct Subscriptions
+{
+    /// subscribers by their root object
+    QHash<const GtObject*, QVector<Subscriber>> subscribers;
+
+    quint64 nextId{1};
+};
+
+Subscriptions&
+subscriptions()
+{
+    static thread_local Subscriptions s;
+    return s;
+}
+
+} // namespace
+
+GtObjectChangeDispatcher::Subscription::~Subscription()
+{
+    unsubscribe();
+}
+
+GtObjectChangeDispatcher::Subscription::Subscription(
+        Subscription&& other) noexcept :
+    m_root(std::move(other.m_root)),
+    m_id(other.m_id)
+{
+    other.m_root.clear();
+    other.m_id = 0;
+}
+
+GtObjectChangeDispatcher::Subscription&
+GtObjectChangeDispatcher::Subscription::operator=(Subscription&& other) noexcept
+{
+    if (this != &other)
+    {
+        unsubscribe();
+        m_root = std::move(other.m_root);
+        m_id = other.m_id;
+        other.m_root.clear();
+        other.m_id = 0;
+    }
+
+    return *this;
+}
+
+void
+GtObjectChangeDispatcher::Subscription::unsubscribe()
+{
+    if (m_root)
+    {
+        auto& subscribers = subscriptions().subscribers;
+
+        auto iter = subscribers.find(m_root.data());
+        if (iter != subscribers.end())
+        {
+            QVector<Subscriber>& list = iter.value();
+            list.erase(std::remove_if(list.begin(), list.end(),
+                                      [this](const Subscriber& s) {
+                return s.id == m_id;
+            }), list.end());
+
+            if (list.isEmpty()) subscribers.erase(iter);
+        }
+    }
+
+    m_root.clear();
+    m_id = 0;
+}
+
+bool
+GtObjectChangeDispatcher::Subscription::isActive() const
+{
+    return m_root && m_id != 0;
+}
+
+GtObjectChangeDispatcher::Subscription
+GtObjectChangeDispatcher::subscribe(GtObject& root,
+                                    Callback callback,
+                                    Filter filter)
+{
+    Subscriptions& s = subscriptions();
+
+    Subscription retval;
+    retval.m_root = &root;
+    retval.m_id = s.nextId++;
+
+    s.subscribers[&root].append(Subscriber{retval.m_id, std::move(callback),
+                                           std::move(filter)});
+
+    return retval;
+}
+
+int
+GtObjectChangeDispatcher::numberOfSubscriptions(const GtObject& root)
+{
+    return subscriptions().subscribers.value(&root).size();
+}
+
+bool
+GtObjectChangeDispatcher::hasSubscriptions()
+{
+    return !subscriptions().subscribers.isEmpty();
+}
+
+void
+GtObjectChangeDispatcher::dispatch(const GtObject& root,
+                                   GtObject* object,
+                                   GtAbstractProperty* property)
+{
+    auto& subscribers = subscriptions().subscribers;
+
+    auto iter = subscribers.constFind(&root);
+    if (iter == subscribers.constEnd()) return;
+
+    // callbacks may subscribe or unsubscribe
+    QVector<Subscriber> const list = iter.value();
+
+    for (Subscriber const& s : list)
+    {
+        if (!s.filter || s.filter(object, property))
+        {
+            s.callback(object, property);
+        }
+    }
+}
+
+void
+GtObjectChangeDispatcher::remove(const GtObject& root)
+{
+    subscriptions().subscribers.remove(&root);
+}
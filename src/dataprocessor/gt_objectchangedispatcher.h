@@ -0,0 +1,139 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTOBJECTCHANGEDISPATCHER_H
+#define GTOBJECTCHANGEDISPATCHER_H
+
+#include "gt_datamodel_exports.h"
+
+#include <QPointer>
+
+#include <functional>
+
+class GtObject;
+class GtAbstractProperty;
+
+/**
+ * @brief Delivers the changes of objects to the subscribers of the subtrees
+ * containing the objects. A changed object reports its change once, the
+ * dispatcher walks up the parents of the object and calls the subscribers
+ * registered at each of them. No signals are relayed between the objects.
+ *
+ * The `dataChanged` signals of the changed object are always emitted. The
+ * signals of its parents are only emitted if they are connected.
+ *
+ * Subscriptions belong to the thread of their root object and have to be
+ * made in this thread.
+ *
+ * Usage:
+ *
+ * auto subscription = GtObjectChangeDispatcher::subscribe(
+ *     project, [](GtObject* obj, GtAbstractProperty* property) { ... });
+ */
+class GT_DATAMODEL_EXPORT GtObjectChangeDispatcher
+{
+public:
+    /**
+     * @brief Called for each change in the subtree
+     * @param object Changed object
+     * @param property Changed property (nullptr if the object changed)
+     */
+    using Callback = std::function<void(GtObject* object,
+                                        GtAbstractProperty* property)>;
+
+    /**
+     * @brief Selects the changes delivered to a subscriber
+     * @param object Changed object
+     * @param property Changed property (nullptr if the object changed)
+     * @return Whether the change is delivered
+     */
+    using Filter = std::function<bool(const GtObject* object,
+                                      const GtAbstractProperty* property)>;
+
+    /**
+     * @brief Handle of a subscription. The subscription ends if the handle
+     * is destroyed or the root object is deleted.
+     */
+    class GT_DATAMODEL_EXPORT Subscription
+    {
+    public:
+        Subscription() = default;
+        ~Subscription();
+
+        Subscription(Subscription&& other) noexcept;
+        Subscription& operator=(Subscription&& other) noexcept;
+
+        Subscription(const Subscription&) = delete;
+        Subscription& operator=(const Subscription&) = delete;
+
+        /**
+         * @brief Ends the subscription
+         */
+        void unsubscribe();
+
+        /**
+         * @brief Returns whether the subscription is active
+         * @return Whether the subscription is active
+         */
+        bool isActive() const;
+
+    private:
+        friend class GtObjectChangeDispatcher;
+
+        /// root object of the subscription
+        QPointer<GtObject> m_root;
+
+        /// id of the subscription
+        quint64 m_id{0};
+    };
+
+    /**
+     * @brief Subscribes to the changes of the root object and all its
+     * descendants.
+     * @param root Root object of the subtree
+     * @param callback Called for each change
+     * @param filter Selects the changes (optional, all changes if empty)
+     * @return Subscription handle
+     */
+    static Subscription subscribe(GtObject& root,
+                                  Callback callback,
+                                  Filter filter = {});
+
+    /**
+     * @brief Returns the number of subscriptions to the subtree of the object
+     * @param root Root object of the subtree
+     * @return Number of subscriptions
+     */
+    static int numberOfSubscriptions(const GtObject& root);
+
+private:
+    friend class GtObject;
+
+    /**
+     * @brief Returns whether there are subscriptions in the current thread
+     * @return Whether there are subscriptions
+     */
+    static bool hasSubscriptions();
+
+    /**
+     * @brief Delivers a change to the subscribers of the root object
+     * @param root Object, whose subscribers are called
+     * @param object Changed object
+     * @param property Changed property
+     */
+    static void dispatch(const GtObject& root,
+                         GtObject* object,
+                         GtAbstractProperty* property);
+
+    /**
+     * @brief Removes all subscriptions of the root object. Called if the
+     * object is destroyed
+     * @param root Root object
+     */
+    static void remove(const GtObject& root);
+};
+
+#endif // GTOBJECTCHANGEDISPATCHER_H
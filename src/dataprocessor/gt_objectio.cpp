@@ -12,14 +12,16 @@
 #include <QStringList>
 #include <QMetaProperty>
 #include <QDomDocument>
+#include <QXmlStreamWriter>
+#include <QXmlStreamReader>
 #include <QUuid>
 #include <QPointF>
 #include <QDataStream>
 #include <QtGlobal>
 #include <QDebug>
 #include <QMetaType>
+#include <QtEndian>
 
-#include <cfloat>
 #include <typeinfo>
 
 #include "gt_object.h"
@@ -33,6 +35,7 @@
 #include "gt_exceptions.h"
 #include "gt_xmlutilities.h"
 #include "gt_xmlexpr.h"
+#include "internal/gt_listconversion.h"
 
 #include "gt_objectio.h"
 
@@ -126,6 +129,59 @@ namespace
 
         return funcMap;
     }
+
+    /**
+     * @brief Encodes the values as base64 string of their little endian
+     * representation
+     */
+    template <typename List>
+    QString
+    toBase64(const List& list)
+    {
+        using T = typename List::value_type;
+
+        QByteArray bytes(list.size() * int(sizeof(T)), Qt::Uninitialized);
+        auto* data = reinterpret_cast<uchar*>(bytes.data());
+
+        for (const T& value : list)
+        {
+            qToLittleEndian(value, data);
+            data += sizeof(T);
+        }
+
+        return QString::fromLatin1(bytes.toBase64());
+    }
+
+    /**
+     * @brief Decodes the values of a base64 string created by `toBase64`
+     * @return Whether the string could be decoded
+     */
+    template <typename List>
+    bool
+    fromBase64(const QString& str, List& list)
+    {
+        using T = typename List::value_type;
+
+        QByteArray const bytes = QByteArray::fromBase64(str.toLatin1());
+
+        if (bytes.size() % sizeof(T) != 0)
+        {
+            return false;
+        }
+
+        auto const* data = reinterpret_cast<const uchar*>(bytes.constData());
+        int const size = bytes.size() / int(sizeof(T));
+
+        list.clear();
+        list.reserve(size);
+
+        for (int i = 0; i < size; ++i, data += sizeof(T))
+        {
+            list.append(qFromLittleEndian<T>(data));
+        }
+
+        return true;
+    }
 }
 
 /** specialization for QVector<double>
@@ -134,35 +190,15 @@ template<>
 inline QString GtObjectIO::listToString<QVector<double> >(
         const QVector<double>& t)
 {
-    // this code is optimized to avoid creating temporaries / reallocating strings,
-    // please don't change unless you still make it faster...
-    QString str;
-    str.reserve(t.size() * (DBL_DIG + 2));
-
-    foreach (double m, t)
-    {
-        str.append(QString::number(m, 'g', DBL_DIG)).append(';');
-    }
-    str.truncate(str.size() - 1);
-
-    return str;
+    return gt::detail::listToString(t);
 }
 
-/** specialization for QList<bool>
+/** specialization for QList<int>
  */
 template<>
 inline QString GtObjectIO::listToString<QList<int> >(const QList<int>& t)
 {
-    QString str;
-    str.reserve(t.size() * 5);
-
-    foreach (int m, t)
-    {
-        str += QString::number(m) + ";";
-    }
-    str.truncate(str.size() - 1);
-
-    return str;
+    return gt::detail::listToString(t);
 }
 
 /** specialization for QList<bool>
@@ -170,16 +206,7 @@ inline QString GtObjectIO::listToString<QList<int> >(const QList<int>& t)
 template<>
 inline QString GtObjectIO::listToString<QList<bool> >(const QList<bool>& t)
 {
-    QString str;
-    str.reserve(t.size()*6);
-
-    foreach (bool m, t)
-    {
-        str += m ? QStringLiteral("true;") : QStringLiteral("false;");
-    }
-    str.truncate(str.size() - 1);
-
-    return str;
+    return gt::detail::listToString(t);
 }
 
 /** specialization for QList<QPointF>
@@ -188,17 +215,7 @@ template<>
 inline QString GtObjectIO::listToString<QList<QPointF> >(
         const QList<QPointF>& t)
 {
-    QString str;
-    str.reserve(2 * t.size() * (DBL_DIG + 2));
-
-    for (QPointF const& m : t)
-    {
-        str.append(QString::number(m.x(), 'g', DBL_DIG)).append("_").append(
-                    QString::number(m.y(), 'g', DBL_DIG)).append(';');
-    }
-    str.truncate(str.size()-1);
-
-    return str;
+    return gt::detail::listToString(t);
 }
 
 /** specialization for QList<QPointF>
@@ -221,6 +238,25 @@ GtObjectIO::setFactory(GtAbstractObjectFactory* factory)
 
 GtObjectMemento
 GtObjectIO::toMemento(const GtObject* o, bool clone)
+{
+    // global object element
+    GtObjectMemento memento = toPropertyMemento(o, clone);
+
+    // child objects
+    auto const& directChildren = o->childObjects();
+    memento.childObjects.reserve(directChildren.size());
+
+    for (const GtObject* child : directChildren)
+    {
+        // recursion through GtObjectMemento constructor
+        memento.childObjects.push_back(GtObjectMemento(child, clone));
+    }
+
+    return memento;
+}
+
+GtObjectMemento
+GtObjectIO::toPropertyMemento(const GtObject* o, bool clone)
 {
     // global object element
     GtObjectMemento memento;
@@ -251,17 +287,132 @@ GtObjectIO::toMemento(const GtObject* o, bool clone)
     // object name
     memento.setIdent(o->objectName());
 
-    // child objects
-    auto const directChildren = o->findDirectChildren();
-    memento.childObjects.reserve(directChildren.size());
+    return memento;
+}
 
-    for (const GtObject* child : directChildren)
+bool
+GtObjectIO::writeObject(const GtObject* o, QXmlStreamWriter& writer)
+{
+    if (!o)
     {
-        // recursion through GtObjectMemento constructor
-        memento.childObjects.push_back(GtObjectMemento(child, clone));
+        return false;
     }
 
-    return memento;
+    // only the data of this object is kept in memory
+    const GtObjectMemento memento = toPropertyMemento(o, true);
+
+    // attributes are written in alphabetical order
+    writer.writeStartElement(gt::xml::S_OBJECT_TAG);
+    writer.writeAttribute(gt::xml::S_CLASS_TAG, memento.className());
+    writer.writeAttribute(gt::xml::S_NAME_TAG, memento.ident());
+    writer.writeAttribute(gt::xml::S_UUID_TAG, memento.uuid());
+
+    // store property information
+    for (const GtObjectMemento::PropertyData& property : memento.properties)
+    {
+        writeProperty(property, writer);
+    }
+
+    for (const GtObjectMemento::PropertyData& property :
+         memento.propertyContainers)
+    {
+        writer.writeStartElement(gt::xml::S_PROPERTYCONT_TAG);
+        writer.writeAttribute(gt::xml::S_NAME_TAG, property.name);
+
+        for (const auto& childProperty : property.childProperties)
+        {
+            writeProperty(childProperty, writer);
+        }
+
+        writer.writeEndElement();
+    }
+
+    // children
+    auto const& children = o->childObjects();
+
+    if (!children.isEmpty())
+    {
+        writer.writeStartElement(gt::xml::S_OBJECTLIST_TAG);
+
+        for (const GtObject* child : children)
+        {
+            if (!writeObject(child, writer))
+            {
+                return false;
+            }
+        }
+
+        writer.writeEndElement();
+    }
+
+    writer.writeEndElement();
+
+    return !writer.hasError();
+}
+
+void
+GtObjectIO::writeProperty(const GtObjectMemento::PropertyData& property,
+                          QXmlStreamWriter& writer)
+{
+    using PD = GtObjectMemento::PropertyData;
+
+    QString tag = gt::xml::S_PROPERTY_TAG;
+    QString type = property.dataType();
+    QString text;
+    // enums and property lists always contain a text node
+    bool writeText = false;
+
+    switch (property.type())
+    {
+    case PD::ENUM_T:
+        text = property.data().toString();
+        writeText = true;
+        break;
+    case PD::STRUCT_T:
+        break;
+    case PD::DATA_T:
+        if (usePropertyList(property.data()))
+        {
+            tag = gt::xml::S_PROPERTYLIST_TAG;
+            propertyListStringType(property.data(), text, type);
+            writeText = true;
+        }
+        else
+        {
+            text = variantToString(property.data());
+            writeText = !text.isEmpty();
+        }
+        break;
+    }
+
+    // attributes are written in alphabetical order
+    writer.writeStartElement(tag);
+
+    // only write active, if active == false, otherwise assume true
+    if (!property.isActive)
+    {
+        writer.writeAttribute(gt::xml::S_ACTIVE_TAG,
+                              QVariant(false).toString());
+    }
+
+    writer.writeAttribute(gt::xml::S_NAME_TAG, property.name);
+    writer.writeAttribute(gt::xml::S_TYPE_TAG, type);
+
+    if (writeText)
+    {
+        // remove carriage returns to avoid double definitions
+        writer.writeCharacters(text.remove(QLatin1Char('\r')));
+    }
+
+    if (property.type() == PD::STRUCT_T)
+    {
+        for (const auto& subchild : property.childProperties)
+        {
+            writeProperty(subchild, writer);
+        }
+    }
+
+    writer.writeEndElement();
 }
 
 QDomElement
@@ -697,6 +848,402 @@ readProperty(const QDomElement& element, bool& error)
 
 } // namespace
 
+namespace
+{
+
+/**
+ * @brief Reads the text of the current element including the text of all
+ * child elements. Text nodes containing whitespace only are skipped, which
+ * matches QDomElement::text() of a document parsed with default settings.
+ * Afterwards, the reader is positioned at the end element.
+ * @param reader Xml stream reader
+ * @return Element text
+ */
+QString
+readStreamElementText(QXmlStreamReader& reader)
+{
+    QString text;
+    QString run;
+    int depth = 1;
+
+    while (depth > 0 && !reader.atEnd())
+    {
+        QXmlStreamReader::TokenType token = reader.readNext();
+
+        if (token == QXmlStreamReader::Characters)
+        {
+            run += reader.text();
+            continue;
+        }
+
+        // character data may be reported in several chunks
+        if (!run.trimmed().isEmpty())
+        {
+            text += run;
+        }
+        run.clear();
+
+        if (token == QXmlStreamReader::StartElement)
+        {
+            ++depth;
+        }
+        else if (token == QXmlStreamReader::EndElement)
+        {
+            --depth;
+        }
+    }
+
+    return text;
+}
+
+QString
+streamAttribute(const QXmlStreamReader& reader, const char* name)
+{
+    return reader.attributes().value(QLatin1String(name)).toString();
+}
+
+bool
+isStreamElement(const QXmlStreamReader& reader, const char* name)
+{
+    return reader.name() == QLatin1String(name);
+}
+
+GtObjectMemento::PropertyData
+readStreamProperty(QXmlStreamReader& reader)
+{
+    GtObjectMemento::PropertyData propData;
+
+    QString fieldType = streamAttribute(reader, gt::xml::S_TYPE_TAG);
+    QString fieldActive = streamAttribute(reader, gt::xml::S_ACTIVE_TAG);
+
+    propData.name = streamAttribute(reader, gt::xml::S_NAME_TAG);
+    propData.setData(propertyToVariant(readStreamElementText(reader),
+                                       fieldType));
+
+    if (!fieldActive.isEmpty())
+    {
+        propData.isActive = QVariant(fieldActive).toBool();
+    }
+
+    return propData;
+}
+
+bool
+readStreamPropertyList(QXmlStreamReader& reader,
+                       GtObjectMemento::PropertyData& propData)
+{
+    QString fieldType = streamAttribute(reader, gt::xml::S_TYPE_TAG);
+    QString fieldName = streamAttribute(reader, gt::xml::S_NAME_TAG);
+    QString text = readStreamElementText(reader);
+
+    if (fieldType.isEmpty() || fieldName.isEmpty())
+    {
+        return false;
+    }
+
+    propData.name = fieldName;
+    propData.setData(propertyListToVariant(text, fieldType));
+
+    return true;
+}
+
+bool
+readStreamStructPropertyEntry(QXmlStreamReader& reader,
+                              GtObjectMemento::PropertyData& pd)
+{
+    const auto typeName = streamAttribute(reader, gt::xml::S_TYPE_TAG);
+    const auto name = streamAttribute(reader, gt::xml::S_NAME_TAG);
+
+    if (typeName.isEmpty() || name.isEmpty())
+    {
+        gtError().noquote().nospace()
+                << "Empty " << (typeName.isEmpty() ? "type" : "name")
+                << " in property container entry on line "
+                << reader.lineNumber();
+        reader.skipCurrentElement();
+        return false;
+    }
+
+    pd.toStruct(typeName);
+    pd.name = name;
+
+    while (reader.readNextStartElement())
+    {
+        if (isStreamElement(reader, gt::xml::S_PROPERTY_TAG))
+        {
+            pd.childProperties.push_back(readStreamProperty(reader));
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    return true;
+}
+
+GtObjectMemento::PropertyData
+readStreamPropertyContainer(QXmlStreamReader& reader)
+{
+    GtObjectMemento::PropertyData pd;
+    pd.name = streamAttribute(reader, gt::xml::S_NAME_TAG);
+
+    while (reader.readNextStartElement())
+    {
+        GtObjectMemento::PropertyData entry;
+
+        if (isStreamElement(reader, gt::xml::S_PROPERTY_TAG))
+        {
+            if (readStreamStructPropertyEntry(reader, entry))
+            {
+                pd.childProperties.push_back(std::move(entry));
+            }
+        }
+        else
+        {
+            reader.skipCurrentElement();
+        }
+    }
+
+    return pd;
+}
+
+/**
+ * @brief Reads the property related element at the current position of the
+ * reader into the memento. Other elements are not consumed.
+ * @param reader Xml stream reader
+ * @param memento Memento to store the property data
+ * @return True, if the element was a property element
+ */
+bool
+readStreamPropertyElement(QXmlStreamReader& reader, GtObjectMemento& memento)
+{
+    if (isStreamElement(reader, gt::xml::S_PROPERTY_TAG))
+    {
+        memento.properties.push_back(readStreamProperty(reader));
+        return true;
+    }
+
+    if (isStreamElement(reader, gt::xml::S_PROPERTYLIST_TAG))
+    {
+        GtObjectMemento::PropertyData propData;
+
+        if (readStreamPropertyList(reader, propData))
+        {
+            memento.properties.push_back(std::move(propData));
+        }
+        return true;
+    }
+
+    if (isStreamElement(reader, gt::xml::S_PROPERTYCONT_TAG))
+    {
+        memento.propertyContainers.push_back(
+            readStreamPropertyContainer(reader));
+        return true;
+    }
+
+    return false;
+}
+
+GtObjectMemento
+streamObjectHeader(const QXmlStreamReader& reader)
+{
+    return GtObjectMemento{}
+        .setClassName(streamAttribute(reader, gt::xml::S_CLASS_TAG))
+        .setUuid(streamAttribute(reader, gt::xml::S_UUID_TAG))
+        .setIdent(streamAttribute(reader, gt::xml::S_NAME_TAG));
+}
+
+} // namespace
+
+GtObjectMemento
+GtObjectIO::toMemento(QXmlStreamReader& reader)
+{
+    assert(isStreamElement(reader, gt::xml::S_OBJECT_TAG));
+
+    auto memento = streamObjectHeader(reader);
+
+    bool childrenRead = false;
+
+    while (reader.readNextStartElement())
+    {
+        if (readStreamPropertyElement(reader, memento))
+        {
+            continue;
+        }
+
+        // only the first object list is considered
+        if (!childrenRead && isStreamElement(reader, gt::xml::S_OBJECTLIST_TAG))
+        {
+            childrenRead = true;
+
+            while (reader.readNextStartElement())
+            {
+                if (isStreamElement(reader, gt::xml::S_OBJECT_TAG))
+                {
+                    memento.childObjects.push_back(toMemento(reader));
+                }
+                else
+                {
+                    reader.skipCurrentElement();
+                }
+            }
+            continue;
+        }
+
+        reader.skipCurrentElement();
+    }
+
+    return memento;
+}
+
+GtObject*
+GtObjectIO::readObject(QXmlStreamReader& reader, GtObject* parent)
+{
+    assert(isStreamElement(reader, gt::xml::S_OBJECT_TAG));
+
+    if (!m_factory)
+    {
+        gtError() << QObject::tr("No object factory set!");
+        reader.skipCurrentElement();
+        return nullptr;
+    }
+
+    const QString className = streamAttribute(reader, gt::xml::S_CLASS_TAG);
+
+    std::unique_ptr<GtObject> obj(m_factory->newObject(className, nullptr));
+
+    if (!obj)
+    {
+        // dummy objects store the complete data of their subtree
+        return toMemento(reader).toObject(*m_factory, parent);
+    }
+
+    // set the uuid before appending, thus no uuid is generated for an
+    // indexed parent
+    obj->setUuid(streamAttribute(reader, gt::xml::S_UUID_TAG));
+
+    if (parent)
+    {
+        parent->appendChild(obj.get());
+    }
+
+    if (!mergeObject(reader, *obj))
+    {
+        return nullptr;
+    }
+
+    return obj.release();
+}
+
+bool
+GtObjectIO::mergeObject(QXmlStreamReader& reader, GtObject& obj)
+{
+    assert(isStreamElement(reader, gt::xml::S_OBJECT_TAG));
+
+    if (!m_factory)
+    {
+        gtError() << QObject::tr("No object factory set!");
+        reader.skipCurrentElement();
+        return false;
+    }
+
+    // properties of this object only, the subtree is read while parsing
+    auto memento = streamObjectHeader(reader);
+
+    if (obj.isDummy())
+    {
+        return toMemento(reader).mergeTo(obj, *m_factory);
+    }
+
+    if (obj.metaObject()->className() != memento.className())
+    {
+        reader.skipCurrentElement();
+        return false;
+    }
+
+    obj.setUuid(memento.uuid());
+    obj.setObjectName(memento.ident());
+
+    // old children, which are neither default objects nor merged, are
+    // deleted afterwards (see GtObjectMemento::mergeTo)
+    QList<GtObject*> oldChildObjs = obj.findDirectChildren<GtObject*>();
+
+    bool propertiesMerged = false;
+    bool childrenRead = false;
+
+    auto mergeProperties = [&]() {
+        if (!propertiesMerged)
+        {
+            memento.mergePropertiesTo(obj);
+            propertiesMerged = true;
+        }
+    };
+
+    while (reader.readNextStartElement())
+    {
+        if (readStreamPropertyElement(reader, memento))
+        {
+            continue;
+        }
+
+        if (childrenRead || !isStreamElement(reader, gt::xml::S_OBJECTLIST_TAG))
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        childrenRead = true;
+
+        // properties are set before the children are created
+        mergeProperties();
+
+        while (reader.readNextStartElement())
+        {
+            if (!isStreamElement(reader, gt::xml::S_OBJECT_TAG))
+            {
+                reader.skipCurrentElement();
+                continue;
+            }
+
+            const QString ident = streamAttribute(reader, gt::xml::S_NAME_TAG);
+
+            auto* child = obj.findDirectChild<GtObject*>(ident);
+
+            if (child &&
+                child->metaObject()->className() ==
+                    streamAttribute(reader, gt::xml::S_CLASS_TAG) &&
+                (child->uuid() == streamAttribute(reader, gt::xml::S_UUID_TAG)
+                 || child->isDefault()))
+            {
+                mergeObject(reader, *child);
+                oldChildObjs.removeOne(child);
+            }
+            else
+            {
+                readObject(reader, &obj);
+            }
+        }
+    }
+
+    mergeProperties();
+
+    if (reader.hasError())
+    {
+        return false;
+    }
+
+    for (auto& child : oldChildObjs)
+    {
+        assert(child);
+        if (!child->isDefault()) delete child;
+    }
+
+    obj.onObjectDataMerged();
+
+    return true;
+}
+
 
 GtObjectMemento::PropertyData
 GtObjectIO::toPropertyContainerData(const GtPropertyStructContainer& vec) const
@@ -839,9 +1386,45 @@ GtObjectIO::propertyContainerDataToDomElement(
     return containerElement;
 }
 
+GtObjectIO::ListEncoding
+GtObjectIO::listEncoding(const QVariant& var)
+{
+    static int const type_QDoubleVector = qMetaTypeId<QVector<double>>();
+    static int const type_QIntList = qMetaTypeId<QList<int>>();
+
+    int const threshold = gt::xml::binaryListThreshold();
+    if (threshold <= 0)
+    {
+        return TextEncoding;
+    }
+
+    int size = 0;
+    if (var.userType() == type_QDoubleVector)
+    {
+        size = static_cast<const QVector<double>*>(var.constData())->size();
+    }
+    else if (var.userType() == type_QIntList)
+    {
+        size = static_cast<const QList<int>*>(var.constData())->size();
+    }
+    else
+    {
+        return TextEncoding;
+    }
+
+    return size >= threshold ? BinaryEncoding : TextEncoding;
+}
+
 void
 GtObjectIO::propertyListStringType(const QVariant& var, QString& valStr,
                                    QString& typeStr)
+{
+    propertyListStringType(var, valStr, typeStr, listEncoding(var));
+}
+
+void
+GtObjectIO::propertyListStringType(const QVariant& var, QString& valStr,
+                                   QString& typeStr, ListEncoding encoding)
 {
     static QVariant::Type type_QDoubleVector = QVariant::nameToType(
                 "QVector<double>");
@@ -860,11 +1443,21 @@ GtObjectIO::propertyListStringType(const QVariant& var, QString& valStr,
     assert(type_QPointFList != QVariant::Invalid);
     assert(type_QStringList == QVariant::StringList);
 
-    if (var.type() == type_QDoubleVector)
+    if (var.type() == type_QDoubleVector && encoding == BinaryEncoding)
+    {
+        valStr = toBase64(var.value<QVector<double> >());
+        typeStr = gt::xml::S_DOUBLE_BASE64_TYPE;
+    }
+    else if (var.type() == type_QDoubleVector)
     {
         valStr = listToString(var.value<QVector<double> >());
         typeStr = QStringLiteral("double");
     }
+    else if (var.type() == type_QIntList && encoding == BinaryEncoding)
+    {
+        valStr = toBase64(var.value<QList<int> >());
+        typeStr = gt::xml::S_INT_BASE64_TYPE;
+    }
     else if (var.type() == type_QIntList)
     {
         valStr = listToString(var.value<QList<int> >());
@@ -970,34 +1563,42 @@ propertyListToVariant(const QString& value, const QString& type)
 {
     QVariant var;
 
-    if (type == QStringLiteral("double"))
+    if (type == gt::xml::S_DOUBLE_BASE64_TYPE)
     {
-        QVector<QStringRef> strList =
-                QStringRef(&value).split(';', Qt::SkipEmptyParts);
         QVector<double> list;
-        list.reserve(strList.size());
 
-        foreach (const auto& val, strList)
+        if (!fromBase64(value, list))
         {
-            list.append(val.toDouble());
+            gtWarning() << QObject::tr("Invalid binary double list!");
+            return var;
         }
 
         var.setValue(list);
     }
-    else if (type == QStringLiteral("bool"))
+    else if (type == gt::xml::S_INT_BASE64_TYPE)
     {
-        QVector<QStringRef> strList =
-                QStringRef(&value).split(';', Qt::SkipEmptyParts);
-        QList<bool> list;
-        list.reserve(strList.size());
+        QList<int> list;
 
-        foreach (const auto& val, strList)
+        if (!fromBase64(value, list))
         {
-            list.append(QVariant(val.toString()).toBool());
+            gtWarning() << QObject::tr("Invalid binary int list!");
+            return var;
         }
 
         var.setValue(list);
     }
+    else if (type == QStringLiteral("double"))
+    {
+        var.setValue(gt::detail::doubleListFromString(value));
+    }
+    else if (type == QStringLiteral("int"))
+    {
+        var.setValue(gt::detail::intListFromString(value));
+    }
+    else if (type == QStringLiteral("bool"))
+    {
+        var.setValue(gt::detail::boolListFromString(value));
+    }
     else if (type == QStringLiteral("QString") ||
              type == QStringLiteral("string"))
     {
@@ -1011,20 +1612,7 @@ propertyListToVariant(const QString& value, const QString& type)
     }
     else if (type == QStringLiteral("QPointF"))
     {
-        QList<QPointF> list;
-        QStringList values = value.split(QStringLiteral(";"));
-
-        foreach (const QString& val, values)
-        {
-            QStringList pvars = val.split(QStringLiteral("_"));
-
-            if (pvars.size() == 2)
-            {
-                list << QPointF(pvars[0].toDouble(), pvars[1].toDouble());
-            }
-        }
-
-        var.setValue(list);
+        var.setValue(gt::detail::pointListFromString(value));
     }
 
     return var;
@@ -1441,7 +2029,7 @@ handleObjectAdd(GtObject& parent,
         return false;
     }
 
-    int numberOfChildren = parent.findDirectChildren().size();
+    int numberOfChildren = parent.childObjects().size();
 
     if (ind >= numberOfChildren)
     {
@@ -1553,7 +2141,7 @@ handleIndexChange(GtObject& parent,
 
     toMove->setParent(nullptr);
 
-    if (newIndex > parent.findDirectChildren().size())
+    if (newIndex > parent.childObjects().size())
     {
         parent.appendChild(toMove);
     }
@@ -19,6 +19,8 @@
 
 class QDomElement;
 class QDomDocument;
+class QXmlStreamWriter;
+class QXmlStreamReader;
 class GtObject;
 class GtAbstractObjectFactory;
 class GtObjectMementoDiff;
@@ -48,6 +50,12 @@ public:
         @return GtObjectMemento memento */
     GtObjectMemento toMemento(const GtObject* o, bool clone = true);
 
+    /** Creates a memento of the given GtObject without its child objects.
+        @param o GtObject pointer
+        @param clone Wether identiy information should be cloned or not
+        @return GtObjectMemento memento */
+    GtObjectMemento toPropertyMemento(const GtObject* o, bool clone);
+
     /** Creates QDomElement from given GtObjectMemento.
         @param m GtObjectMemento
         @param doc Reference to QDomDocument to generate new QDomElements
@@ -66,11 +74,57 @@ public:
     QDomElement toDomElement(const GtObjectMemento::PropertyData& m,
                              QDomDocument& doc);
 
+    /** Writes the given GtObject and all of its children directly into the
+        xml stream. The output is identical to the attribute-ordered xml of
+        the object's memento, but neither a memento nor a dom tree of the
+        whole subtree is created.
+        @param o GtObject pointer
+        @param writer Xml stream writer
+        @return Whether the object was written successfully */
+    bool writeObject(const GtObject* o, QXmlStreamWriter& writer);
+
+    /**
+     * Writes property memento data into the xml stream. The output is
+     * identical to the attribute-ordered xml of the property's dom element.
+     *
+     * @param property A memento property
+     * @param writer Xml stream writer
+     */
+    static void writeProperty(const GtObjectMemento::PropertyData& property,
+                              QXmlStreamWriter& writer);
+
     /** Creates Memento from given QDomElement.
         @param e QDomElement with memento data
         @return GtObjectMemento memento */
     GtObjectMemento toMemento(const QDomElement& e);
 
+    /** Creates Memento from the object element at the current position of
+        the xml stream. The reader must be positioned at the start element
+        of the object and is positioned at its end element afterwards.
+        @param reader Xml stream reader
+        @return GtObjectMemento memento */
+    GtObjectMemento toMemento(QXmlStreamReader& reader);
+
+    /** Creates a new GtObject from the object element at the current
+        position of the xml stream. Objects and properties are created and
+        set while parsing, no memento of the subtree is created. Unknown
+        classes are restored as dummy objects. The reader must be positioned
+        at the start element of the object and is positioned at its end
+        element afterwards. Requires an object factory.
+        @param reader Xml stream reader
+        @param parent Parent of the new object
+        @return New object or nullptr if the object could not be created */
+    GtObject* readObject(QXmlStreamReader& reader, GtObject* parent = nullptr);
+
+    /** Merges the object element at the current position of the xml stream
+        into the given object. Equivalent to GtObjectMemento::mergeTo but
+        without creating a memento of the subtree. Requires an object
+        factory.
+        @param reader Xml stream reader
+        @param obj Object to merge the data into
+        @return Whether the data was merged successfully */
+    bool mergeObject(QXmlStreamReader& reader, GtObject& obj);
+
 
     /**
      * @brief applyDiff
@@ -110,6 +164,24 @@ public:
         }
     }
 
+    /**
+     * @brief Encoding of property lists
+     */
+    enum ListEncoding
+    {
+        TextEncoding = 0,
+        BinaryEncoding
+    };
+
+    /**
+     * @brief Returns the encoding used to store the given list. Double and
+     * int lists reaching the binary list threshold are stored binary
+     * (see gt::xml::setBinaryListThreshold).
+     * @param var List
+     * @return Encoding
+     */
+    static ListEncoding listEncoding(const QVariant& var);
+
     /**
      * @brief propertyListString
      * @param var
@@ -119,6 +191,19 @@ public:
                                        QString& valStr,
                                        QString& typeStr);
 
+    /**
+     * @brief Overload using the given encoding. Lists that cannot be stored
+     * binary are always stored as text.
+     * @param var List
+     * @param valStr Encoded list
+     * @param typeStr Type of the encoded list
+     * @param encoding Encoding
+     */
+    static void propertyListStringType(const QVariant& var,
+                                       QString& valStr,
+                                       QString& typeStr,
+                                       ListEncoding encoding);
+
     /**
      * @brief detect wether a QVariant data element would
      *        be stored as propertylist instead of property element.
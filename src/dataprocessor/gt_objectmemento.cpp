@@ -12,7 +12,13 @@
 #include <QBuffer>
 #include <QIODevice>
 #include <QDataStream>
+#include <QHash>
 #include <QMetaProperty>
+#include <QSet>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <atomic>
 
 #include "gt_externalizedobject.h"
 #include "gt_objectmemento.h"
@@ -59,6 +65,12 @@ GtObjectMemento::GtObjectMemento(const QByteArray& byteArray)
 
 }
 
+GtObjectMemento
+GtObjectMemento::propertiesOnly(const GtObject& obj, bool clone)
+{
+    return GtObjectIO().toPropertyMemento(&obj, clone);
+}
+
 bool
 GtObjectMemento::isNull() const
 {
@@ -144,11 +156,27 @@ GtObjectMemento::canCastTo(const QString& classname,
     return classHierarchy.contains(classname);
 }
 
+namespace
+{
+
+/// Selected hash algorithm
+std::atomic<int> s_hashAlgorithm{GtObjectMemento::FastHash};
+
+/// Minimum number of objects of a memento tree to hash it in parallel
+constexpr int S_PARALLEL_HASH_THRESHOLD = 256;
+
+/// SHA-256 hash, which can be default constructed
+struct Sha256 : public QCryptographicHash
+{
+    Sha256() : QCryptographicHash(QCryptographicHash::Sha256) {}
+};
+
+template <typename Hash>
 void
-propertyHashHelper(const PD& property, QCryptographicHash& hash,
-                                    gt::detail::VariantHasher& variantHasher)
+propertyHashHelper(const PD& property, Hash& hash,
+                   gt::detail::VariantHasher& variantHasher)
 {
-    QCryptographicHash propHash(QCryptographicHash::Sha256);
+    Hash propHash;
 
     // hash property
     propHash.addData(property.name.toUtf8());
@@ -160,7 +188,7 @@ propertyHashHelper(const PD& property, QCryptographicHash& hash,
     variantHasher.addToHash(propHash, property.data());
 
     // loop recursively through all child properties
-    foreach(const auto& p, property.childProperties)
+    for (const auto& p : property.childProperties)
     {
         propertyHashHelper(p, propHash, variantHasher);
     }
@@ -171,45 +199,195 @@ propertyHashHelper(const PD& property, QCryptographicHash& hash,
     hash.addData(property.hash);
 }
 
-void
-GtObjectMemento::calculateHashes() const
+template <typename Hash>
+QByteArray
+calcPropertyHash(const GtObjectMemento& memento)
 {
-    if (!m_fullHash.isNull())
-    {
-        return;
-    }
-
     // initialize hash function
-    QCryptographicHash hash(QCryptographicHash::Sha256);
+    Hash hash;
 
     // hash members
-    hash.addData(className().toUtf8());
-    hash.addData(uuid().toUtf8());
-    hash.addData(ident().toUtf8());
+    hash.addData(memento.className().toUtf8());
+    hash.addData(memento.uuid().toUtf8());
+    hash.addData(memento.ident().toUtf8());
     // hash properties
     gt::detail::VariantHasher variantHasher;
-    foreach(const auto &p, properties)
+    for (const auto& p : memento.properties)
     {
         propertyHashHelper(p, hash, variantHasher);
     }
 
-    foreach(const PropertyData &p, propertyContainers)
+    for (const auto& p : memento.propertyContainers)
     {
         propertyHashHelper(p, hash, variantHasher);
     }
 
-    // store property hash
-    m_propertyHash = hash.result();
-    hash.reset();
+    return hash.result();
+}
 
+inline const QByteArray&
+childHash(const GtObjectMemento& child)
+{
+    return child.fullHash();
+}
+
+inline const QByteArray&
+childHash(const QByteArray& hash)
+{
+    return hash;
+}
+
+template <typename Hash, typename Children>
+QByteArray
+calcFullHash(const QByteArray& propertyHash, const Children& children)
+{
     // hash over property hash and child elements
-    hash.addData(m_propertyHash);
-    for (int i = 0; i < childObjects.size(); i++)
+    Hash hash;
+    hash.addData(propertyHash);
+
+    for (const auto& child : children)
+    {
+        hash.addData(childHash(child));
+    }
+
+    return hash.result();
+}
+
+/// Counts the unhashed mementos of a tree up to the given maximum
+int
+countUnhashed(const GtObjectMemento& memento, int max)
+{
+    if (!memento.fullHash().isNull())
+    {
+        return 0;
+    }
+
+    int count = 1;
+    for (const auto& child : memento.childObjects)
     {
-        childObjects[i].calculateHashes();
-        hash.addData(childObjects[i].m_fullHash);
+        if (count >= max) break;
+        count += countUnhashed(child, max - count);
+    }
+    return count;
+}
+
+/// Collects independent subtrees of the memento, which are not hashed yet
+std::vector<const GtObjectMemento*>
+unhashedSubtrees(const GtObjectMemento& memento, int minCount)
+{
+    std::vector<const GtObjectMemento*> subtrees{&memento};
+
+    bool expanded = true;
+    while (expanded && static_cast<int>(subtrees.size()) < minCount)
+    {
+        expanded = false;
+
+        std::vector<const GtObjectMemento*> next;
+        for (auto const* subtree : subtrees)
+        {
+            if (subtree->childObjects.isEmpty())
+            {
+                next.push_back(subtree);
+                continue;
+            }
+
+            expanded = true;
+            for (const auto& child : subtree->childObjects)
+            {
+                if (child.fullHash().isNull()) next.push_back(&child);
+            }
+        }
+
+        subtrees = std::move(next);
     }
-    m_fullHash = hash.result();
+
+    return subtrees;
+}
+
+} // namespace
+
+void
+GtObjectMemento::setHashAlgorithm(HashAlgorithm algorithm)
+{
+    s_hashAlgorithm = algorithm;
+}
+
+GtObjectMemento::HashAlgorithm
+GtObjectMemento::hashAlgorithm()
+{
+    return static_cast<HashAlgorithm>(s_hashAlgorithm.load());
+}
+
+void
+GtObjectMemento::calculateHashes() const
+{
+    if (!m_fullHash.isNull())
+    {
+        return;
+    }
+
+    // use the same algorithm for the whole tree
+    HashAlgorithm algorithm = hashAlgorithm();
+
+    // hash independent subtrees of large trees in parallel
+    if (countUnhashed(*this, S_PARALLEL_HASH_THRESHOLD) >=
+        S_PARALLEL_HASH_THRESHOLD)
+    {
+        auto subtrees = unhashedSubtrees(*this,
+                                         4 * QThread::idealThreadCount());
+
+        if (subtrees.size() > 1)
+        {
+            QtConcurrent::blockingMap(subtrees,
+                                      [algorithm](const GtObjectMemento* m){
+                m->calculateHashes(algorithm);
+            });
+        }
+    }
+
+    calculateHashes(algorithm);
+}
+
+void
+GtObjectMemento::calculateHashes(HashAlgorithm algorithm) const
+{
+    if (!m_fullHash.isNull())
+    {
+        return;
+    }
+
+    for (const auto& child : childObjects)
+    {
+        child.calculateHashes(algorithm);
+    }
+
+    switch (algorithm)
+    {
+    case Sha256Hash:
+        m_propertyHash = calcPropertyHash<Sha256>(*this);
+        m_fullHash = calcFullHash<Sha256>(m_propertyHash, childObjects);
+        break;
+    case FastHash:
+        m_propertyHash = calcPropertyHash<gt::detail::FastHash>(*this);
+        m_fullHash = calcFullHash<gt::detail::FastHash>(m_propertyHash,
+                                                        childObjects);
+        break;
+    }
+}
+
+QByteArray
+GtObjectMemento::combineHashes(const QByteArray& propertyHash,
+                               const QVector<QByteArray>& childHashes)
+{
+    switch (hashAlgorithm())
+    {
+    case Sha256Hash:
+        return calcFullHash<Sha256>(propertyHash, childHashes);
+    case FastHash:
+        break;
+    }
+
+    return calcFullHash<gt::detail::FastHash>(propertyHash, childHashes);
 }
 
 bool
@@ -327,8 +505,72 @@ GtObjectMemento::externalizationInfo(const GtAbstractObjectFactory& factory) con
     };
 }
 
+namespace
+{
+
+/**
+ * @brief Properties of an object by their ident. Idents are resolved to the
+ * same property as GtObject::findProperty does.
+ */
+class PropertyIndex
+{
+public:
+
+    explicit PropertyIndex(GtObject& obj) : m_obj(obj)
+    {
+        // a linear search is faster for few properties
+        if (obj.properties().size() < S_MIN_INDEXED_PROPERTIES)
+        {
+            return;
+        }
+
+        for (GtAbstractProperty* prop : obj.properties())
+        {
+            add(*prop);
+        }
+        m_indexed = true;
+    }
+
+    GtAbstractProperty* find(const QString& ident) const
+    {
+        if (!m_indexed)
+        {
+            return m_obj.findProperty(ident);
+        }
+
+        return m_properties.value(ident);
+    }
+
+private:
+
+    /// Minimum number of properties to build an index for
+    static constexpr int S_MIN_INDEXED_PROPERTIES = 8;
+
+    GtObject& m_obj;
+
+    QHash<QString, GtAbstractProperty*> m_properties;
+
+    bool m_indexed{false};
+
+    /// adds the property and its sub properties (depth first, first wins)
+    void add(GtAbstractProperty& prop)
+    {
+        if (!m_properties.contains(prop.ident()))
+        {
+            m_properties.insert(prop.ident(), &prop);
+        }
+
+        for (GtAbstractProperty* sub : prop.fullProperties())
+        {
+            add(*sub);
+        }
+    }
+};
+
+} // namespace
+
 bool
-readProperty(const PD& p, GtObject& obj)
+readProperty(const PD& p, GtObject& obj, const PropertyIndex& index)
 {
 
     QString fieldType = p.dataType();
@@ -339,7 +581,7 @@ readProperty(const PD& p, GtObject& obj)
         return false;
     }
 
-    auto* prop = obj.findProperty(fieldName);
+    auto* prop = index.find(fieldName);
 
     if (prop)
     {
@@ -368,10 +610,11 @@ readProperties(const GtObjectMemento& memento,
 
     assert(!obj.isDummy());
 
+    PropertyIndex const index(obj);
 
     for (auto const & p :  memento.properties)
     {
-        bool success = readProperty(p, obj);
+        bool success = readProperty(p, obj, index);
 
         if (!success)
         {
@@ -527,7 +770,9 @@ GtObject*
 GtObjectMemento::toObject(GtAbstractObjectFactory& factory, GtObject* parent) const
 {
 
-    std::unique_ptr<GtObject> obj(factory.newObject(className(), parent));
+    // the object is appended after setting its uuid. Otherwise an uuid
+    // would be generated for an indexed parent, which is overwritten anyway
+    std::unique_ptr<GtObject> obj(factory.newObject(className(), nullptr));
 
     if (!obj)
     {
@@ -536,10 +781,17 @@ GtObjectMemento::toObject(GtAbstractObjectFactory& factory, GtObject* parent) co
             << "Creating dummy object for unknown class '"
             << className() << "'.";
 
-        obj.reset(new GtObject(parent));
+        obj.reset(new GtObject);
         obj->makeDummy();
     }
 
+    obj->setUuid(uuid());
+
+    if (parent)
+    {
+        parent->appendChild(obj.get());
+    }
+
     mergeTo(*obj, factory);
 
     return obj.release();
@@ -559,8 +811,7 @@ GtObjectMemento::mergeTo(GtObject& obj, GtAbstractObjectFactory& factory) const
 
     if (!obj.isDummy())
     {
-        ::readProperties(*this, obj);
-        ::mergeAllPropertyContainers(*this, obj);
+        mergePropertiesTo(obj);
     }
     else
     {
@@ -572,13 +823,25 @@ GtObjectMemento::mergeTo(GtObject& obj, GtAbstractObjectFactory& factory) const
     // There are two exceptions:
     //   - a child is a default object. Then, it must not be deleted
     //   - a memento was merged into a child. Then, the child must be kept as well
-    QList<GtObject*> oldChildObjs = obj.findDirectChildren<GtObject*>();
+    QVector<GtObject*> const oldChildObjs = obj.childObjects();
+    QSet<GtObject*> mergedChildObjs;
+
+    // first child with a given ident as found by findDirectChild
+    QHash<QString, GtObject*> childByIdent;
+    childByIdent.reserve(oldChildObjs.size() + childObjects.size());
+    for (GtObject* child : oldChildObjs)
+    {
+        if (!childByIdent.contains(child->objectName()))
+        {
+            childByIdent.insert(child->objectName(), child);
+        }
+    }
 
     // loop over all childs in memento, that are not yet in the object
     for (auto const & mementoChild : childObjects)
     {
         // find object with same ident
-        const auto child = obj.findDirectChild<GtObject*>(mementoChild.ident());
+        GtObject* const child = childByIdent.value(mementoChild.ident());
 
         // check, whether this object can be merged
         if (child &&
@@ -588,25 +851,39 @@ GtObjectMemento::mergeTo(GtObject& obj, GtAbstractObjectFactory& factory) const
             mementoChild.mergeTo(*child, factory);
 
             // since memento has been merged to child, child needs to be kept
-            oldChildObjs.removeOne(child);
+            mergedChildObjs.insert(child);
         }
         else
         {
             // we need to create a new object
             auto newobj = mementoChild.toObject(factory, &obj);
             assert(newobj);
-            Q_UNUSED(newobj);
+
+            if (!childByIdent.contains(newobj->objectName()))
+            {
+                childByIdent.insert(newobj->objectName(), newobj);
+            }
         }
     }
 
     // Clean up all old childs, which have not been merged
-    for (auto& child : oldChildObjs)
+    for (GtObject* child : oldChildObjs)
     {
         assert(child);
-        if (!child->isDefault()) delete child;
+        if (!child->isDefault() && !mergedChildObjs.contains(child))
+        {
+            delete child;
+        }
     }
 
     obj.onObjectDataMerged();
 
     return true;
 }
+
+void
+GtObjectMemento::mergePropertiesTo(GtObject& obj) const
+{
+    ::readProperties(*this, obj);
+    ::mergeAllPropertyContainers(*this, obj);
+}
@@ -51,6 +51,15 @@ public:
      */
     explicit GtObjectMemento(const QByteArray& byteArray);
 
+    /**
+     * @brief Creates a memento of the object without its child objects.
+     * @param obj Object
+     * @param clone Whether the uuid should be kept or not
+     * @return Memento containing only the properties of the object
+     */
+    static GtObjectMemento propertiesOnly(const GtObject& obj,
+                                          bool clone = true);
+
     /**
      * @brief interface from QDomElement
      */
@@ -237,10 +246,46 @@ public:
     const QByteArray& fullHash() const {return m_fullHash;}
 
     /**
-     * @brief update fullHash and propertyHash, needs to be called before accessing these
+     * @brief update fullHash and propertyHash, needs to be called before accessing these.
+     * Large trees are hashed in parallel.
      */
     void calculateHashes() const;
 
+    /**
+     * @brief Calculates a full hash from a property hash and the full hashes
+     * of the child objects, in the same way as `calculateHashes` does.
+     * @param propertyHash Property hash
+     * @param childHashes Full hashes of the child objects
+     * @return Full hash
+     */
+    static QByteArray combineHashes(const QByteArray& propertyHash,
+                                    const QVector<QByteArray>& childHashes);
+
+    /**
+     * @brief Algorithms used to calculate the hashes of mementos
+     */
+    enum HashAlgorithm
+    {
+        /// Cryptographic SHA-256 hash
+        Sha256Hash = 0,
+        /// Fast non-cryptographic 128 bit hash (default)
+        FastHash
+    };
+
+    /**
+     * @brief Sets the algorithm used to calculate the hashes of mementos.
+     * Hashes calculated using different algorithms must not be compared,
+     * thus the algorithm should only be set on startup.
+     * @param algorithm Hash algorithm
+     */
+    static void setHashAlgorithm(HashAlgorithm algorithm);
+
+    /**
+     * @brief Returns the algorithm used to calculate the hashes of mementos
+     * @return Hash algorithm
+     */
+    static HashAlgorithm hashAlgorithm();
+
     struct ExternalizationInfo
     {
         bool isFetched = true;
@@ -257,6 +302,8 @@ public:
     QVector<GtObjectMemento> childObjects;
 
 private:
+    friend class GtObjectIO;
+
     /**
      * @brief Creates a new object and adds it to the given parent
      *
@@ -266,6 +313,20 @@ private:
      */
     GtObject* toObject(GtAbstractObjectFactory& factory, GtObject* parent) const;
 
+    /**
+     * @brief Merges the properties and property containers of the memento
+     * into the given object. Child objects are not considered.
+     * @param obj Object to merge the properties into
+     */
+    void mergePropertiesTo(GtObject& obj) const;
+
+    /**
+     * @brief Calculates the hashes of this memento and its children using
+     * the given algorithm
+     * @param algorithm Hash algorithm
+     */
+    void calculateHashes(HashAlgorithm algorithm) const;
+
     QString m_className, m_uuid, m_ident;
 
     /**
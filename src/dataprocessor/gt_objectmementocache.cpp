@@ -0,0 +1,195 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_objectmementocache.h"
+
+#include "gt_object.h"
+#include "gt_objectmementodiff.h"
+#include "gt_objectchangebatch.h"
+
+#include <QHash>
+
+GtObjectMementoCache::GtObjectMementoCache() = default;
+
+GtObjectMementoCache::~GtObjectMementoCache()
+{
+    clear();
+}
+
+GtObjectMemento
+GtObjectMementoCache::memento(GtObject& obj) const
+{
+    // changes collected by an active batch are journaled first
+    GtObjectChangeBatch::flush();
+
+    if (!contains(obj))
+    {
+        return obj.toMemento();
+    }
+
+    return update(obj, m_memento);
+}
+
+void
+GtObjectMementoCache::store(GtObject& obj, GtObjectMemento memento)
+{
+    if (m_root != &obj)
+    {
+        clear();
+
+        m_root = &obj;
+
+        m_connections.append(
+            QObject::connect(&obj, qOverload<GtObject*>(&GtObject::dataChanged),
+                             [this](GtObject* o) { onDataChanged(o); }));
+        m_connections.append(
+            QObject::connect(&obj, qOverload<GtObject*, GtAbstractProperty*>(
+                                 &GtObject::dataChanged),
+                             [this](GtObject* o, GtAbstractProperty*) {
+                onDataChanged(o);
+            }));
+        m_connections.append(
+            QObject::connect(&obj, &GtObject::childAppended,
+                             [this](GtObject* child, GtObject* parent) {
+                m_appended.insert(child);
+                onDataChanged(parent);
+            }));
+    }
+
+    memento.calculateHashes();
+
+    m_memento = std::move(memento);
+    m_journal.clear();
+    m_changed.clear();
+    m_appended.clear();
+}
+
+GtObjectMementoDiff
+GtObjectMementoCache::commit(GtObject& obj)
+{
+    GtObjectChangeBatch::flush();
+
+    GtObjectMementoDiff diff;
+
+    if (!contains(obj))
+    {
+        store(obj, obj.toMemento());
+        return diff;
+    }
+
+    if (hasChanges())
+    {
+        GtObjectMemento memento = update(obj, m_memento, &diff);
+        memento.calculateHashes();
+
+        if (memento.fullHash() == obj.contentHash())
+        {
+            store(obj, std::move(memento));
+            return diff;
+        }
+    }
+    else if (m_memento.fullHash() == obj.contentHash())
+    {
+        return diff;
+    }
+
+    // changes that were not signaled are not part of the journal, hence the
+    // whole object is compared
+    GtObjectMemento memento = obj.toMemento();
+    diff = GtObjectMementoDiff(m_memento, memento);
+    store(obj, std::move(memento));
+
+    return diff;
+}
+
+bool
+GtObjectMementoCache::hasChanges() const
+{
+    return !m_changed.isEmpty();
+}
+
+void
+GtObjectMementoCache::clear()
+{
+    for (auto const& connection : qAsConst(m_connections))
+    {
+        QObject::disconnect(connection);
+    }
+
+    m_connections.clear();
+    m_root.clear();
+    m_memento = GtObjectMemento{};
+    m_journal.clear();
+    m_changed.clear();
+    m_appended.clear();
+}
+
+bool
+GtObjectMementoCache::contains(const GtObject& obj) const
+{
+    return m_root == &obj && !m_memento.isNull();
+}
+
+void
+GtObjectMementoCache::onDataChanged(const GtObject* obj)
+{
+    m_journal.insert(obj);
+
+    // parents of changed objects are already marked
+    for (; obj && !m_changed.contains(obj); obj = obj->parentObject())
+    {
+        m_changed.insert(obj);
+
+        if (obj == m_root) break;
+    }
+}
+
+GtObjectMemento
+GtObjectMementoCache::update(const GtObject& obj,
+                             const GtObjectMemento& cached,
+                             GtObjectMementoDiff* diff) const
+{
+    if (!m_changed.contains(&obj))
+    {
+        return cached;
+    }
+
+    // the diff of a changed object includes all its children
+    GtObjectMementoDiff* childDiff = m_journal.contains(&obj) ? nullptr : diff;
+
+    GtObjectMemento memento = GtObjectMemento::propertiesOnly(obj);
+
+    QHash<QString, const GtObjectMemento*> cachedChildren;
+    cachedChildren.reserve(cached.childObjects.size());
+
+    for (const GtObjectMemento& child : cached.childObjects)
+    {
+        cachedChildren.insert(child.uuid(), &child);
+    }
+
+    auto const& children = obj.childObjects();
+    memento.childObjects.reserve(children.size());
+
+    for (const GtObject* child : children)
+    {
+        auto iter = cachedChildren.find(child->uuid());
+
+        if (iter == cachedChildren.end() || m_appended.contains(child))
+        {
+            memento.childObjects.push_back(child->toMemento());
+            continue;
+        }
+
+        memento.childObjects.push_back(update(*child, **iter, childDiff));
+    }
+
+    if (diff && !childDiff)
+    {
+        *diff << GtObjectMementoDiff(cached, memento);
+    }
+
+    return memento;
+}
@@ -0,0 +1,127 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GTOBJECTMEMENTOCACHE_H
+#define GTOBJECTMEMENTOCACHE_H
+
+#include "gt_datamodel_exports.h"
+#include "gt_objectmemento.h"
+
+#include <QPointer>
+#include <QSet>
+#include <QVector>
+
+class GtObject;
+class GtObjectMementoDiff;
+
+/**
+ * @brief Keeps the memento of an object tree including its hashes. Creating a
+ * new memento of the object only serializes the objects, which changed since
+ * the memento was stored. All unchanged subtrees including their hashes are
+ * reused.
+ *
+ * Changes are tracked using the `dataChanged` and `childAppended` signals of
+ * the object. The changed objects form a journal, which is used to create the
+ * diff to the stored memento without comparing the whole object tree.
+ * Changes that are not signaled are not part of the journal, they are only
+ * detected by `commit`, which compares the hash of the object.
+ */
+class GT_DATAMODEL_EXPORT GtObjectMementoCache
+{
+public:
+    GtObjectMementoCache();
+    ~GtObjectMementoCache();
+
+    GtObjectMementoCache(const GtObjectMementoCache&) = delete;
+    GtObjectMementoCache& operator=(const GtObjectMementoCache&) = delete;
+
+    /**
+     * @brief Returns a memento of the object. If a memento of the object is
+     * stored, all its unchanged parts are reused.
+     * @param obj Object
+     * @return Memento of the object
+     */
+    GtObjectMemento memento(GtObject& obj) const;
+
+    /**
+     * @brief Stores the memento of the object for later use and tracks all
+     * changes of the object from now on. The hashes of the memento are
+     * calculated if not done already.
+     * @param obj Object
+     * @param memento Memento representing the current state of the object
+     */
+    void store(GtObject& obj, GtObjectMemento memento);
+
+    /**
+     * @brief Stores the current state of the object and returns the changes
+     * since the last stored state. Only the changed objects are serialized
+     * and compared. If the resulting memento does not match the hash of the
+     * object, e.g. due to changes that were not signaled, the whole object
+     * is serialized and compared. If no memento of the object is stored, the
+     * current state is stored and an empty diff is returned.
+     * @param obj Object
+     * @return Diff between the last stored state and the current state
+     */
+    GtObjectMementoDiff commit(GtObject& obj);
+
+    /**
+     * @brief Returns whether the object changed since its memento was stored
+     * @return Whether the object changed
+     */
+    bool hasChanges() const;
+
+    /**
+     * @brief Removes the stored memento.
+     */
+    void clear();
+
+    /**
+     * @brief Returns whether a memento of the object is stored
+     * @param obj Object
+     * @return Whether a memento is stored
+     */
+    bool contains(const GtObject& obj) const;
+
+private:
+    /// object of the stored memento
+    QPointer<GtObject> m_root;
+
+    /// stored memento
+    GtObjectMemento m_memento;
+
+    /// changed objects
+    QSet<const GtObject*> m_journal;
+
+    /// changed objects and their parents
+    QSet<const GtObject*> m_changed;
+
+    /// objects appended since the memento was stored
+    QSet<const GtObject*> m_appended;
+
+    /// connections to the root object
+    QVector<QMetaObject::Connection> m_connections;
+
+    /**
+     * @brief Records the object in the journal and marks all its parents as
+     * changed
+     * @param obj Changed object
+     */
+    void onDataChanged(const GtObject* obj);
+
+    /**
+     * @brief Creates a memento of the object reusing the unchanged parts of
+     * the cached memento.
+     * @param obj Object
+     * @param cached Cached memento of the object
+     * @param diff Diff to append the changes of the object to (optional)
+     * @return Memento of the object
+     */
+    GtObjectMemento update(const GtObject& obj,
+                           const GtObjectMemento& cached,
+                           GtObjectMementoDiff* diff = nullptr) const;
+};
+
+#endif // GTOBJECTMEMENTOCACHE_H
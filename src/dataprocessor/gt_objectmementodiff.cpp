@@ -751,10 +751,16 @@ GtObjectMementoDiff::handlePropertyChange(const PD& leftProp,
         QDomElement oldVal = this->createElement(gt::xml::S_DIFF_OLDVAL_TAG);
         QDomElement newVal = this->createElement(gt::xml::S_DIFF_NEWVAL_TAG);
 
+        // both values must be encoded the same way
+        auto encoding = std::max(GtObjectIO::listEncoding(leftProp.data()),
+                                 GtObjectIO::listEncoding(rightProp.data()));
+
         QString leftVal, leftType;
         QString rightVal, rightType;
-        GtObjectIO::propertyListStringType(leftProp.data(), leftVal, leftType);
-        GtObjectIO::propertyListStringType(rightProp.data(), rightVal, rightType);
+        GtObjectIO::propertyListStringType(leftProp.data(), leftVal, leftType,
+                                           encoding);
+        GtObjectIO::propertyListStringType(rightProp.data(), rightVal,
+                                           rightType, encoding);
 
         diffObj.setAttribute(gt::xml::S_TYPE_TAG, leftType);
 
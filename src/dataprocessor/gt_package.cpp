@@ -11,8 +11,14 @@
 #include "gt_package.h"
 #include "gt_objectmemento.h"
 #include "gt_objectfactory.h"
+#include "gt_objectio.h"
+#include "gt_xmlutilities.h"
 #include "gt_logging.h"
 
+#include <QDomDocument>
+#include <QXmlStreamWriter>
+#include <QXmlStreamReader>
+
 GtPackage::GtPackage()
 {
     setObjectName("Package");
@@ -61,6 +67,64 @@ GtPackage::readData(const QDomElement& root)
     return true;
 }
 
+bool
+GtPackage::readDataFromStream(QXmlStreamReader& reader)
+{
+    if (!usesDefaultDataFormat())
+    {
+        QDomDocument doc;
+        QDomElement root = gt::xml::readDomElementFromStream(reader, doc);
+
+        if (reader.hasError())
+        {
+            return false;
+        }
+
+        return readData(root);
+    }
+
+    GtObjectIO oio(gtObjectFactory);
+
+    while (reader.readNextStartElement())
+    {
+        QXmlStreamAttributes attrs = reader.attributes();
+
+        if (reader.name() != QLatin1String("object") ||
+            attrs.value(QStringLiteral("uuid")).isEmpty())
+        {
+            reader.skipCurrentElement();
+            continue;
+        }
+
+        // default object
+        GtObject* dobj = findDirectChild<GtObject*>(
+            attrs.value(QStringLiteral("name")).toString());
+
+        if (dobj)
+        {
+            dobj->setFactory(gtObjectFactory);
+            oio.mergeObject(reader, *dobj);
+        }
+        else
+        {
+            GtObject* cobj = oio.readObject(reader);
+
+            if (cobj)
+            {
+                appendChild(cobj);
+            }
+            else
+            {
+                gtWarning() << tr("unknown data element skipped!")
+                            << "(" << attrs.value(QStringLiteral("class")).toString()
+                            << ")";
+            }
+        }
+    }
+
+    return !reader.hasError();
+}
+
 bool GtPackage::readMiscData(const QDir &projectDir)
 {
     return true;
@@ -78,7 +142,88 @@ GtPackage::saveData(QDomElement& root, QDomDocument& /*doc*/)
     return true;
 }
 
+bool
+GtPackage::saveDataToStream(QXmlStreamWriter& writer)
+{
+    if (usesDefaultDataFormat())
+    {
+        writer.writeAttribute(QStringLiteral("uuid"), uuid());
+
+        // stream all child objects
+        GtObjectIO oio;
+
+        for (const GtObject* obj : childObjects())
+        {
+            if (!oio.writeObject(obj, writer))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    QDomDocument doc;
+    QDomElement root = doc.createElement(QStringLiteral("GTLABMODULE"));
+    root.setAttribute(QStringLiteral("uuid"), uuid());
+
+    if (!saveData(root, doc))
+    {
+        return false;
+    }
+
+    // write all attributes of the module element in sorted order
+    QStringList attrIds;
+    QDomNamedNodeMap attrNodes = root.attributes();
+
+    for (int i = 0; i < attrNodes.size(); ++i)
+    {
+        attrIds << attrNodes.item(i).toAttr().name();
+    }
+
+    attrIds.sort();
+
+    for (const QString& attrId : qAsConst(attrIds))
+    {
+        writer.writeAttribute(attrId, root.attribute(attrId));
+    }
+
+    QDomElement e = root.firstChildElement();
+    while (!e.isNull())
+    {
+        if (!gt::xml::writeDomElementOrderedAttribute(e, writer))
+        {
+            return false;
+        }
+
+        e = e.nextSiblingElement();
+    }
+
+    return true;
+}
+
 bool GtPackage::saveMiscData(const QDir &projectDir)
 {
     return true;
 }
+
+bool
+GtPackage::usesDefaultDataFormat() const
+{
+    return false;
+}
+
+bool
+GtPackage::isThreadSafe() const
+{
+    return isThreadSafe(*metaObject());
+}
+
+bool
+GtPackage::isThreadSafe(const QMetaObject& metaObject)
+{
+    int idx = metaObject.indexOfClassInfo("threadSafe");
+
+    return idx >= 0 &&
+           qstrcmp(metaObject.classInfo(idx).value(), "true") == 0;
+}
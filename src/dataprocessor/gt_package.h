@@ -18,9 +18,20 @@
 class QDomElement;
 class QDomDocument;
 class QDir;
+class QXmlStreamWriter;
+class QXmlStreamReader;
 
 /**
  * @brief The GtPackage class
+ *
+ * Packages whose readData, saveData, readMiscData and saveMiscData methods
+ * may run concurrently to other packages declare themselves thread safe
+ * using the class info
+ *
+ *     Q_CLASSINFO("threadSafe", "true")
+ *
+ * The module files of thread safe packages are read and saved in parallel,
+ * all other packages are read and saved on the calling thread.
  */
 class GT_DATAMODEL_EXPORT GtPackage : public GtObject
 {
@@ -36,6 +47,23 @@ public:
      */
     virtual bool readData(const QDomElement& root);
 
+    /**
+     * @brief Reads the package data directly from the given xml stream.
+     *
+     * Objects are created and their properties are set while parsing,
+     * neither a dom tree of the module file nor mementos of the objects are
+     * created, if the package uses the default data format. All other
+     * packages are read using their readData implementation, the element
+     * passed to readData only contains elements, attributes and text.
+     * Projects read the module files of these packages into a dom document
+     * instead.
+     *
+     * @param reader Xml stream reader positioned at the module element. It
+     * is positioned at the end of the module element afterwards.
+     * @return Returns true if data was successfully read.
+     */
+    bool readDataFromStream(QXmlStreamReader& reader);
+
     /**
      * @brief Reads additional package data that are stored in the project dir
      * @param projectDir Directory of the project
@@ -51,6 +79,24 @@ public:
      */
     virtual bool saveData(QDomElement& root, QDomDocument& doc);
 
+    /**
+     * @brief Saves the package data directly into the given xml stream.
+     *
+     * The child objects of packages using the default data format are
+     * serialized one after another without creating mementos or a dom tree
+     * of the package, hence the memory required for saving does not depend
+     * on the size of the package. All other packages are saved using their
+     * saveData implementation.
+     *
+     * The attributes of the module element, i.e. the uuid of the package
+     * and the attributes set by saveData, are written in sorted order.
+     *
+     * @param writer Xml stream writer. The module element must already be
+     * opened.
+     * @return Returns true if data was successfully saved.
+     */
+    bool saveDataToStream(QXmlStreamWriter& writer);
+
     /**
      * @brief Saves additional package data that are stored in the project dir
      * @param projectDir Directory of the project
@@ -59,12 +105,38 @@ public:
      */
     virtual bool saveMiscData(const QDir& projectDir);
 
+    /**
+     * @brief Returns whether the package uses the default data format, i.e.
+     * the module file only contains the serialized child objects. Packages
+     * that do not reimplement readData and saveData may return true to be
+     * read and saved using the xml stream based methods. Packages are not
+     * opted in by default, since reimplementations of readData and saveData
+     * cannot be detected.
+     *
+     * @return True if the default data format is used. False by default.
+     */
+    virtual bool usesDefaultDataFormat() const;
+
+    /**
+     * @brief Returns whether the package is declared thread safe, i.e. it
+     * may be read and saved concurrently to other packages.
+     * @return True if the package is thread safe
+     */
+    bool isThreadSafe() const;
+
+    /**
+     * @brief Returns whether the package class is declared thread safe using
+     * the class info "threadSafe".
+     * @param metaObject Meta object of the package class
+     * @return True if the package class is thread safe
+     */
+    static bool isThreadSafe(const QMetaObject& metaObject);
+
 protected:
     /**
      * @brief GtPackage
      */
     GtPackage();
-
 };
 
 #endif // GTPACKAGE_H
@@ -45,6 +45,10 @@ constexpr const char * S_DIFF_ATTR_REMOVE_TAG = "diff-attribute-remove";
 constexpr const char * S_DIFF_NEWVAL_TAG = "newVal";
 constexpr const char * S_DIFF_OLDVAL_TAG = "oldVal";
 
+/// types of property lists stored as base64 encoded little endian values
+constexpr const char * S_DOUBLE_BASE64_TYPE = "double-base64";
+constexpr const char * S_INT_BASE64_TYPE = "int-base64";
+
 } // namespace xml
 } // namespace gt
 
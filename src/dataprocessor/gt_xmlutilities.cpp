@@ -11,6 +11,7 @@
 
 #include <QDomElement>
 #include <QXmlStreamWriter>
+#include <QXmlStreamReader>
 #include <QTextStream>
 #include <QFile>
 
@@ -20,6 +21,8 @@
 
 #include "gt_logging.h"
 
+#include <atomic>
+
 
 namespace
 {
@@ -43,6 +46,9 @@ findElements(
     }
 }
 
+/// minimum size of binary lists
+std::atomic<int> s_binaryListThreshold{0};
+
 } // namespace
 
 QList<QDomElement>
@@ -156,6 +162,36 @@ gt::xml::writeDomDocumentToFile(const QString& filePath,
     return true;
 }
 
+bool
+gt::xml::writeStreamDocumentToFile(
+        const QString& filePath,
+        const std::function<bool(QXmlStreamWriter&)>& writeContent)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        return false;
+    }
+
+    QXmlStreamWriter str_w(&file);
+    str_w.setCodec("UTF-8");
+    str_w.setAutoFormatting(true);
+
+    str_w.writeStartDocument(QStringLiteral("1.0"));
+
+    if (!writeContent(str_w))
+    {
+        return false;
+    }
+
+    str_w.writeEndDocument();
+
+    file.close();
+
+    return !str_w.hasError();
+}
+
 QDomElement
 gt::xml::createPropertyElement(QDomDocument &doc, const QString &propertyId,
                             const QString &propertyType, const QString &value)
@@ -207,6 +243,70 @@ QDomElement gt::xml::findPropertyElement(const QDomElement &root,
 
 }
 
+QDomElement
+gt::xml::readDomElementFromStream(QXmlStreamReader& reader,
+                                  QDomDocument& doc)
+{
+    if (!reader.isStartElement())
+    {
+        return {};
+    }
+
+    QDomElement element =
+        reader.namespaceUri().isEmpty() ?
+            doc.createElement(reader.name().toString()) :
+            doc.createElementNS(reader.namespaceUri().toString(),
+                                reader.qualifiedName().toString());
+
+    for (const QXmlStreamAttribute& attr : reader.attributes())
+    {
+        if (attr.namespaceUri().isEmpty())
+        {
+            element.setAttribute(attr.name().toString(),
+                                 attr.value().toString());
+        }
+        else
+        {
+            element.setAttributeNS(attr.namespaceUri().toString(),
+                                   attr.qualifiedName().toString(),
+                                   attr.value().toString());
+        }
+    }
+
+    // character data may be reported in several chunks
+    QString text;
+
+    auto appendText = [&]() {
+        if (!text.trimmed().isEmpty())
+        {
+            element.appendChild(doc.createTextNode(text));
+        }
+        text.clear();
+    };
+
+    while (!reader.atEnd())
+    {
+        QXmlStreamReader::TokenType token = reader.readNext();
+
+        if (token == QXmlStreamReader::Characters)
+        {
+            text += reader.text();
+        }
+        else if (token == QXmlStreamReader::StartElement)
+        {
+            appendText();
+            element.appendChild(readDomElementFromStream(reader, doc));
+        }
+        else if (token == QXmlStreamReader::EndElement)
+        {
+            appendText();
+            break;
+        }
+    }
+
+    return element;
+}
+
 bool
 gt::xml::readDomDocumentFromFile(QFile& file,
                                  QDomDocument& doc,
@@ -233,3 +333,15 @@ gt::xml::readDomDocumentFromFile(QFile& file,
 
     return doc.setContent(content, true, errorMsg, errorLine, errorColumn);
 }
+
+void
+gt::xml::setBinaryListThreshold(int size)
+{
+    s_binaryListThreshold = size;
+}
+
+int
+gt::xml::binaryListThreshold()
+{
+    return s_binaryListThreshold;
+}
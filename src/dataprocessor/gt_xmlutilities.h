@@ -17,8 +17,11 @@
 #include <QList>
 #include <QDomElement>
 
+#include <functional>
+
 class QDomDocument;
 class QXmlStreamWriter;
+class QXmlStreamReader;
 class QString;
 class QFile;
 
@@ -53,6 +56,20 @@ bool GT_DATAMODEL_EXPORT writeDomDocumentToFile(const QString& filePath,
                                                 const QDomDocument& doc,
                                                 bool attrOrdered = true);
 
+/**
+ * @brief Writes a XML document to the given file path using a stream writer.
+ * The content of the document is written by the given function. Since the
+ * writer is configured like in writeDomDocumentToFile, the output is
+ * identical to writing the equivalent DOM document with ordered attributes.
+ * @param filePath Target file path (e.g. /home/files/my_file.xml)
+ * @param writeContent Function writing the document content
+ * @return Returns true if entire document was written successfully.
+ * Otherwise, false is returned.
+ */
+bool GT_DATAMODEL_EXPORT writeStreamDocumentToFile(
+        const QString& filePath,
+        const std::function<bool(QXmlStreamWriter&)>& writeContent);
+
 /**
  * @brief This function parses the XML document from given file.
  * File is opened in TextMode. (Fix for broken line endings)
@@ -65,6 +82,21 @@ bool GT_DATAMODEL_EXPORT readDomDocumentFromFile(QFile& file,
                                                  int* errorLine=nullptr,
                                                  int* errorColumn=nullptr);
 
+/**
+ * @brief Reads the element at the current position of the XML stream
+ * including all of its children into a DOM element. Text nodes containing
+ * whitespace only are skipped, as done by QDomDocument::setContent.
+ * The reader must be positioned at the start element and is positioned at
+ * the corresponding end element afterwards.
+ * @param reader XML stream reader
+ * @param doc Document used to create the DOM nodes
+ * @return DOM element. Null element if the reader is not positioned at a
+ * start element.
+ */
+QDomElement GT_DATAMODEL_EXPORT readDomElementFromStream(
+        QXmlStreamReader& reader,
+        QDomDocument& doc);
+
 /**
  * @brief Finds all elements below root of a specific gtobject type
  * @param root      The root element
@@ -129,6 +161,28 @@ inline QDomElement createStringPropertyElement(QDomDocument& doc,
                               std::move(value));
 }
 
+/// Minimum number of entries of binary lists, if binary lists are enabled in
+/// the application settings
+constexpr int S_BINARY_LIST_THRESHOLD = 1000;
+
+/**
+ * @brief Sets the minimum number of entries of double and int lists, which
+ * are stored binary (base64 encoded) instead of as text. Binary lists
+ * are read bit-exactly, but cannot be read by older versions of GTlab.
+ * Binary lists are disabled by default. The application sets the threshold
+ * according to its settings (see GtSettings::storeBinaryLists).
+ * @param size Minimum number of entries. Values <= 0 disable binary lists.
+ */
+GT_DATAMODEL_EXPORT void setBinaryListThreshold(int size);
+
+/**
+ * @brief Returns the minimum number of entries of double and int lists,
+ * which are stored binary. A value <= 0 indicates, that binary lists are
+ * disabled.
+ * @return Minimum number of entries
+ */
+GT_DATAMODEL_EXPORT int binaryListThreshold();
+
 } // namespace xml
 
 } // namespace gt
@@ -88,6 +88,13 @@ struct GtExternalizedObjectPrivate
     /// object states
     ExternalizeStates states{ ExternalizeState::ExternalizeOnSave };
 
+    /// whether modifications are tracked instead of comparing hashes
+    bool tracksModifications{false};
+
+    /// whether the data was modified since it was fetched or externalized
+    /// (only used if modifications are tracked)
+    bool modified{true};
+
     /**
      * @brief Sets the desired state
      * @param state state to set
@@ -0,0 +1,176 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_fasthash.h"
+
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+
+using gt::detail::FastHash;
+
+namespace
+{
+
+constexpr quint64 c1 = 0x87c37b91114253d5ULL;
+constexpr quint64 c2 = 0x4cf5ad432745937fULL;
+
+inline quint64
+rotl(quint64 x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline quint64
+fmix(quint64 k)
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb3fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+inline quint64
+mixK1(quint64 k1)
+{
+    k1 *= c1;
+    k1 = rotl(k1, 31);
+    k1 *= c2;
+    return k1;
+}
+
+inline quint64
+mixK2(quint64 k2)
+{
+    k2 *= c2;
+    k2 = rotl(k2, 33);
+    k2 *= c1;
+    return k2;
+}
+
+} // namespace
+
+FastHash::FastHash()
+{
+    reset();
+}
+
+void
+FastHash::reset()
+{
+    m_h1 = 0;
+    m_h2 = 0;
+    m_length = 0;
+    m_tailSize = 0;
+}
+
+void
+FastHash::processBlock(const uchar* block)
+{
+    quint64 k1 = qFromLittleEndian<quint64>(block);
+    quint64 k2 = qFromLittleEndian<quint64>(block + 8);
+
+    m_h1 ^= mixK1(k1);
+    m_h1 = rotl(m_h1, 27);
+    m_h1 += m_h2;
+    m_h1 = m_h1 * 5 + 0x52dce729;
+
+    m_h2 ^= mixK2(k2);
+    m_h2 = rotl(m_h2, 31);
+    m_h2 += m_h1;
+    m_h2 = m_h2 * 5 + 0x38495ab5;
+}
+
+void
+FastHash::addData(const char* data, int length)
+{
+    if (!data || length <= 0)
+    {
+        return;
+    }
+
+    auto const* bytes = reinterpret_cast<const uchar*>(data);
+    m_length += static_cast<quint64>(length);
+
+    // complete pending block
+    if (m_tailSize > 0)
+    {
+        int n = std::min(S_HASH_SIZE - m_tailSize, length);
+        std::memcpy(m_tail + m_tailSize, bytes, n);
+        m_tailSize += n;
+        bytes += n;
+        length -= n;
+
+        if (m_tailSize < S_HASH_SIZE)
+        {
+            return;
+        }
+
+        processBlock(m_tail);
+        m_tailSize = 0;
+    }
+
+    // process full blocks in place
+    for (; length >= S_HASH_SIZE; length -= S_HASH_SIZE, bytes += S_HASH_SIZE)
+    {
+        processBlock(bytes);
+    }
+
+    std::memcpy(m_tail, bytes, length);
+    m_tailSize = length;
+}
+
+QByteArray
+FastHash::result() const
+{
+    quint64 h1 = m_h1;
+    quint64 h2 = m_h2;
+
+    // remaining bytes
+    quint64 k1 = 0;
+    quint64 k2 = 0;
+
+    for (int i = m_tailSize - 1; i >= 8; --i)
+    {
+        k2 ^= quint64(m_tail[i]) << ((i - 8) * 8);
+    }
+    for (int i = std::min(m_tailSize, 8) - 1; i >= 0; --i)
+    {
+        k1 ^= quint64(m_tail[i]) << (i * 8);
+    }
+
+    if (m_tailSize > 8)
+    {
+        h2 ^= mixK2(k2);
+    }
+    if (m_tailSize > 0)
+    {
+        h1 ^= mixK1(k1);
+    }
+
+    // finalization
+    h1 ^= m_length;
+    h2 ^= m_length;
+
+    h1 += h2;
+    h2 += h1;
+
+    h1 = fmix(h1);
+    h2 = fmix(h2);
+
+    h1 += h2;
+    h2 += h1;
+
+    QByteArray hash(S_HASH_SIZE, Qt::Uninitialized);
+    auto* out = reinterpret_cast<uchar*>(hash.data());
+    qToLittleEndian<quint64>(h1, out);
+    qToLittleEndian<quint64>(h2, out + 8);
+
+    return hash;
+}
@@ -0,0 +1,88 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_INTERNAL_FASTHASH_H
+#define GT_INTERNAL_FASTHASH_H
+
+#include "gt_datamodel_exports.h"
+
+#include <QByteArray>
+
+#include <type_traits>
+
+namespace gt
+{
+namespace detail
+{
+
+/**
+ * @brief Incremental, non-cryptographic 128 bit hash (MurmurHash3 x64 128).
+ * Data may be added in arbitrary chunks, the result only depends on the
+ * concatenated data. Intended for change detection, not for security.
+ */
+class GT_DATAMODEL_EXPORT FastHash
+{
+public:
+
+    /// Size of the hash in bytes
+    static constexpr int S_HASH_SIZE = 16;
+
+    FastHash();
+
+    /**
+     * @brief Adds data to the hash
+     * @param data Data
+     * @param length Length of the data in bytes
+     */
+    void addData(const char* data, int length);
+
+    void addData(const QByteArray& data)
+    {
+        addData(data.constData(), data.size());
+    }
+
+    /**
+     * @brief Adds the bytes of a trivially copyable value to the hash
+     * @param value Value
+     */
+    template <typename T>
+    void addValue(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "value must be trivially copyable");
+        addData(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /**
+     * @brief Returns the hash of the data added so far. Additional data
+     * may be added afterwards.
+     * @return Hash (16 bytes)
+     */
+    QByteArray result() const;
+
+    /**
+     * @brief Resets the hash to its initial state
+     */
+    void reset();
+
+private:
+
+    /// hash state
+    quint64 m_h1, m_h2;
+    /// total number of bytes added
+    quint64 m_length;
+    /// bytes not yet processed
+    uchar m_tail[S_HASH_SIZE];
+    int m_tailSize;
+
+    void processBlock(const uchar* block);
+};
+
+} // namespace detail
+
+} // namespace gt
+
+#endif // GT_INTERNAL_FASTHASH_H
@@ -0,0 +1,600 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gt_listconversion.h"
+
+#include <QByteArray>
+#include <QLocale>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+/// Number of significant digits of the "%.15g" layout
+constexpr int S_PRECISION = 15;
+
+/// Minimum number of characters of a double list to parse it in parallel
+constexpr int S_PARALLEL_PARSE_SIZE = 1 << 20;
+
+/// Exactly representable powers of ten
+constexpr double S_POW10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+constexpr quint64 S_MAX_EXACT_MANTISSA = quint64(1) << 53;
+
+inline bool
+isDigit(QChar c)
+{
+    return c.unicode() >= '0' && c.unicode() <= '9';
+}
+
+inline int
+digitValue(QChar c)
+{
+    return c.unicode() - '0';
+}
+
+/**
+ * @brief Writes the shortest decimal digits of a positive, finite value
+ * @param value Value (> 0)
+ * @param digits Digits without trailing zeros (at least 17 characters)
+ * @param exponent Decimal exponent of the first digit
+ * @return Number of digits
+ */
+int
+shortestDigits(double value, char* digits, int& exponent)
+{
+    // integral values are formatted directly
+    if (value < static_cast<double>(S_MAX_EXACT_MANTISSA) &&
+        value == std::floor(value))
+    {
+        auto i = static_cast<quint64>(value);
+
+        char tmp[20];
+        int n = 0;
+        for (; i > 0; i /= 10)
+        {
+            tmp[n++] = static_cast<char>('0' + i % 10);
+        }
+
+        exponent = n - 1;
+
+        int start = 0;
+        while (tmp[start] == '0') ++start;
+
+        int nDigits = 0;
+        for (int k = n - 1; k >= start; --k)
+        {
+            digits[nDigits++] = tmp[k];
+        }
+
+        return nDigits;
+    }
+
+    // "d.ddde+XX"
+    QByteArray const str =
+        QByteArray::number(value, 'e', QLocale::FloatingPointShortest);
+
+    int nDigits = 0;
+    int pos = 0;
+
+    for (; pos < str.size() && str[pos] != 'e'; ++pos)
+    {
+        if (str[pos] != '.') digits[nDigits++] = str[pos];
+    }
+
+    exponent = str.mid(pos + 1).toInt();
+
+    while (nDigits > 1 && digits[nDigits - 1] == '0') --nDigits;
+
+    return nDigits;
+}
+
+/// Formats a double into the latin1 buffer
+int
+formatDoubleLatin1(double value, char* out)
+{
+    char* p = out;
+
+    if (std::isnan(value))
+    {
+        std::memcpy(p, "nan", 3);
+        return 3;
+    }
+
+    if (std::signbit(value))
+    {
+        *p++ = '-';
+        value = -value;
+    }
+
+    if (std::isinf(value))
+    {
+        std::memcpy(p, "inf", 3);
+        return static_cast<int>(p - out) + 3;
+    }
+
+    if (value == 0.0)
+    {
+        *p++ = '0';
+        return static_cast<int>(p - out);
+    }
+
+    char digits[24];
+    int exponent = 0;
+    int const nDigits = shortestDigits(value, digits, exponent);
+
+    if (exponent < -4 || exponent >= S_PRECISION)
+    {
+        // exponent form
+        *p++ = digits[0];
+
+        if (nDigits > 1)
+        {
+            *p++ = '.';
+            std::memcpy(p, digits + 1, nDigits - 1);
+            p += nDigits - 1;
+        }
+
+        *p++ = 'e';
+        *p++ = exponent < 0 ? '-' : '+';
+
+        int absExp = std::abs(exponent);
+        if (absExp >= 100)
+        {
+            *p++ = static_cast<char>('0' + absExp / 100);
+        }
+        *p++ = static_cast<char>('0' + (absExp / 10) % 10);
+        *p++ = static_cast<char>('0' + absExp % 10);
+    }
+    else if (exponent >= 0)
+    {
+        // decimal form
+        for (int i = 0; i <= exponent; ++i)
+        {
+            *p++ = i < nDigits ? digits[i] : '0';
+        }
+
+        if (nDigits > exponent + 1)
+        {
+            *p++ = '.';
+            std::memcpy(p, digits + exponent + 1, nDigits - exponent - 1);
+            p += nDigits - exponent - 1;
+        }
+    }
+    else
+    {
+        // decimal form of small numbers
+        *p++ = '0';
+        *p++ = '.';
+        for (int i = 0; i < -exponent - 1; ++i)
+        {
+            *p++ = '0';
+        }
+
+        std::memcpy(p, digits, nDigits);
+        p += nDigits;
+    }
+
+    return static_cast<int>(p - out);
+}
+
+/// Formats an integer into the buffer
+int
+formatInt(int value, QChar* out)
+{
+    QChar* p = out;
+
+    qint64 v = value;
+    if (v < 0)
+    {
+        *p++ = QLatin1Char('-');
+        v = -v;
+    }
+
+    char tmp[12];
+    int n = 0;
+    do
+    {
+        tmp[n++] = static_cast<char>('0' + v % 10);
+        v /= 10;
+    }
+    while (v > 0);
+
+    while (n > 0)
+    {
+        *p++ = QLatin1Char(tmp[--n]);
+    }
+
+    return static_cast<int>(p - out);
+}
+
+/**
+ * @brief Writes a list into a preallocated string. The string grows if
+ * the estimated size per entry is exceeded.
+ * @param list List
+ * @param estimate Estimated number of characters per entry
+ * @param maxSize Maximum number of characters per entry
+ * @param format Writes an entry and returns the number of characters written
+ * @return String
+ */
+template <typename List, typename Format>
+QString
+formatList(const List& list, int estimate, int maxSize, Format format)
+{
+    if (list.isEmpty())
+    {
+        return {};
+    }
+
+    QString str(list.size() * (estimate + 1) + maxSize, Qt::Uninitialized);
+    int pos = 0;
+
+    for (const auto& value : list)
+    {
+        if (str.size() - pos < maxSize + 1)
+        {
+            str.resize(str.size() + str.size() / 2 + maxSize + 1);
+        }
+
+        QChar* out = str.data() + pos;
+        pos += format(value, out);
+        str[pos++] = QLatin1Char(';');
+    }
+
+    // remove last separator
+    str.resize(pos - 1);
+
+    return str;
+}
+
+/**
+ * @brief Calls `onEntry` for all ';' separated entries between begin and end.
+ * The separators are searched using QString::indexOf, which is vectorized.
+ * @param begin Begin of the string
+ * @param end End of the string
+ * @param onEntry Called with begin and end of each entry
+ * @param skipEmpty Whether empty entries are skipped
+ */
+template <typename OnEntry>
+void
+forEachEntry(const QChar* begin, const QChar* end, OnEntry onEntry,
+             bool skipEmpty = true)
+{
+    // refers to the data without copying it
+    QString const str = QString::fromRawData(begin,
+                                             static_cast<int>(end - begin));
+    int const size = str.size();
+
+    for (int pos = 0; pos <= size; )
+    {
+        int next = str.indexOf(QLatin1Char(';'), pos);
+        if (next < 0) next = size;
+
+        if (next > pos || !skipEmpty)
+        {
+            onEntry(begin + pos, begin + next);
+        }
+
+        pos = next + 1;
+    }
+}
+
+/// Appends all non empty entries between begin and end to the list
+template <typename List, typename Parse>
+void
+parseList(const QChar* begin, const QChar* end, List& list, Parse parse)
+{
+    list.reserve(list.size() + static_cast<int>(std::count(begin, end,
+                                                QLatin1Char(';'))) + 1);
+
+    forEachEntry(begin, end, [&list, parse](const QChar* b, const QChar* e) {
+        list.append(parse(b, e));
+    });
+}
+
+int
+parseInt(const QChar* begin, const QChar* end)
+{
+    const QChar* p = begin;
+
+    bool negative = false;
+    if (p != end && (*p == QLatin1Char('-') || *p == QLatin1Char('+')))
+    {
+        negative = *p == QLatin1Char('-');
+        ++p;
+    }
+
+    // at most 9 digits cannot overflow
+    if (p == end || end - p > 9)
+    {
+        return QString::fromRawData(begin, static_cast<int>(end - begin))
+            .toInt();
+    }
+
+    int value = 0;
+    for (; p != end; ++p)
+    {
+        if (!isDigit(*p))
+        {
+            return QString::fromRawData(begin, static_cast<int>(end - begin))
+                .toInt();
+        }
+        value = value * 10 + digitValue(*p);
+    }
+
+    return negative ? -value : value;
+}
+
+bool
+parseBool(const QChar* begin, const QChar* end)
+{
+    // same as QVariant(QString).toBool()
+    QString const str = QString::fromRawData(begin,
+                                             static_cast<int>(end - begin));
+
+    return !(str.isEmpty() || str == QLatin1String("0") ||
+             str.compare(QLatin1String("false"), Qt::CaseInsensitive) == 0);
+}
+
+QPointF
+parsePoint(const QChar* begin, const QChar* end, bool& ok)
+{
+    const QChar* sep = std::find(begin, end, QLatin1Char('_'));
+
+    // point must contain exactly two values
+    ok = sep != end && std::find(sep + 1, end, QLatin1Char('_')) == end;
+    if (!ok)
+    {
+        return {};
+    }
+
+    return {gt::detail::parseDouble(begin, sep),
+            gt::detail::parseDouble(sep + 1, end)};
+}
+
+} // namespace
+
+int
+gt::detail::formatDouble(double value, QChar* out)
+{
+    char buffer[S_MAX_DOUBLE_CHARS];
+    int const n = formatDoubleLatin1(value, buffer);
+
+    for (int i = 0; i < n; ++i)
+    {
+        out[i] = QLatin1Char(buffer[i]);
+    }
+
+    return n;
+}
+
+double
+gt::detail::parseDouble(const QChar* begin, const QChar* end)
+{
+    auto fallback = [begin, end]() {
+        return QString::fromRawData(begin, static_cast<int>(end - begin))
+            .toDouble();
+    };
+
+    const QChar* p = begin;
+
+    bool negative = false;
+    if (p != end && (*p == QLatin1Char('-') || *p == QLatin1Char('+')))
+    {
+        negative = *p == QLatin1Char('-');
+        ++p;
+    }
+
+    quint64 mantissa = 0;
+    int nDigits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+
+    auto addDigit = [&](QChar c) {
+        hasDigits = true;
+        int d = digitValue(c);
+        if (mantissa == 0 && d == 0) return true;
+        if (++nDigits > 19) return false;
+        mantissa = mantissa * 10 + d;
+        return true;
+    };
+
+    for (; p != end && isDigit(*p); ++p)
+    {
+        if (!addDigit(*p)) return fallback();
+    }
+
+    if (p != end && *p == QLatin1Char('.'))
+    {
+        for (++p; p != end && isDigit(*p); ++p)
+        {
+            if (!addDigit(*p)) return fallback();
+            --exponent;
+        }
+    }
+
+    if (!hasDigits) return fallback();
+
+    if (p != end && (*p == QLatin1Char('e') || *p == QLatin1Char('E')))
+    {
+        ++p;
+
+        bool negativeExp = false;
+        if (p != end && (*p == QLatin1Char('-') || *p == QLatin1Char('+')))
+        {
+            negativeExp = *p == QLatin1Char('-');
+            ++p;
+        }
+
+        if (p == end || end - p > 4) return fallback();
+
+        int exp = 0;
+        for (; p != end && isDigit(*p); ++p)
+        {
+            exp = exp * 10 + digitValue(*p);
+        }
+
+        exponent += negativeExp ? -exp : exp;
+    }
+
+    // unexpected characters
+    if (p != end) return fallback();
+
+    if (mantissa == 0)
+    {
+        return negative ? -0.0 : 0.0;
+    }
+
+    // the result is exact if both the mantissa and the power of ten are
+    // exactly representable (Clinger's fast path)
+    if (mantissa > S_MAX_EXACT_MANTISSA || exponent < -22 || exponent > 22)
+    {
+        return fallback();
+    }
+
+    double value = static_cast<double>(mantissa);
+    value = exponent < 0 ? value / S_POW10[-exponent] :
+                           value * S_POW10[exponent];
+
+    return negative ? -value : value;
+}
+
+QString
+gt::detail::listToString(const QVector<double>& list)
+{
+    return formatList(list, 18, S_MAX_DOUBLE_CHARS, formatDouble);
+}
+
+QString
+gt::detail::listToString(const QList<int>& list)
+{
+    return formatList(list, 4, 11, formatInt);
+}
+
+QString
+gt::detail::listToString(const QList<bool>& list)
+{
+    return formatList(list, 5, 5, [](bool value, QChar* out) {
+        const char* str = value ? "true" : "false";
+        int const n = value ? 4 : 5;
+        for (int i = 0; i < n; ++i) out[i] = QLatin1Char(str[i]);
+        return n;
+    });
+}
+
+QString
+gt::detail::listToString(const QList<QPointF>& list)
+{
+    return formatList(list, 2 * 18 + 1, 2 * S_MAX_DOUBLE_CHARS + 1,
+                      [](const QPointF& value, QChar* out) {
+        int n = formatDouble(value.x(), out);
+        out[n++] = QLatin1Char('_');
+        return n + formatDouble(value.y(), out + n);
+    });
+}
+
+QVector<double>
+gt::detail::doubleListFromString(const QString& str)
+{
+    const QChar* begin = str.constData();
+    const QChar* end = begin + str.size();
+
+    QVector<double> list;
+
+    int const nChunks = QThread::idealThreadCount();
+
+    if (str.size() < S_PARALLEL_PARSE_SIZE || nChunks < 2)
+    {
+        parseList(begin, end, list, parseDouble);
+        return list;
+    }
+
+    // split at separators into chunks, which are parsed in parallel
+    struct Chunk
+    {
+        const QChar* begin;
+        const QChar* end;
+        QVector<double> values;
+    };
+
+    std::vector<Chunk> chunks;
+    const QChar* chunkBegin = begin;
+
+    for (int i = 1; i <= nChunks; ++i)
+    {
+        const QChar* chunkEnd = end;
+
+        if (i < nChunks)
+        {
+            int pos = str.indexOf(QLatin1Char(';'),
+                                  static_cast<int>(str.size() * qint64(i) /
+                                                   nChunks));
+            chunkEnd = pos < 0 ? end : begin + pos;
+        }
+
+        if (chunkEnd > chunkBegin)
+        {
+            chunks.push_back({chunkBegin, chunkEnd, {}});
+        }
+
+        chunkBegin = std::min(chunkEnd + 1, end);
+    }
+
+    QtConcurrent::blockingMap(chunks, [](Chunk& chunk) {
+        parseList(chunk.begin, chunk.end, chunk.values, parseDouble);
+    });
+
+    int size = 0;
+    for (const Chunk& chunk : chunks) size += chunk.values.size();
+
+    list.reserve(size);
+    for (const Chunk& chunk : chunks) list.append(chunk.values);
+
+    return list;
+}
+
+QList<int>
+gt::detail::intListFromString(const QString& str)
+{
+    QList<int> list;
+    parseList(str.constData(), str.constData() + str.size(), list, parseInt);
+    return list;
+}
+
+QList<bool>
+gt::detail::boolListFromString(const QString& str)
+{
+    QList<bool> list;
+    parseList(str.constData(), str.constData() + str.size(), list,
+              parseBool);
+    return list;
+}
+
+QList<QPointF>
+gt::detail::pointListFromString(const QString& str)
+{
+    QList<QPointF> list;
+    const QChar* begin = str.constData();
+    const QChar* end = begin + str.size();
+
+    // invalid points are skipped
+    forEachEntry(begin, end, [&list](const QChar* b, const QChar* e) {
+        bool ok = false;
+        QPointF point = parsePoint(b, e, ok);
+        if (ok) list.append(point);
+    }, false);
+
+    return list;
+}
@@ -0,0 +1,71 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef GT_INTERNAL_LISTCONVERSION_H
+#define GT_INTERNAL_LISTCONVERSION_H
+
+#include "gt_datamodel_exports.h"
+
+#include <QList>
+#include <QPointF>
+#include <QString>
+#include <QVector>
+
+namespace gt
+{
+namespace detail
+{
+
+/// Maximum number of characters written by `formatDouble`
+constexpr int S_MAX_DOUBLE_CHARS = 32;
+
+/**
+ * @brief Formats a double using the shortest representation, which is read
+ * back to the same value. The layout equals printf's "%.15g", thus values
+ * having up to 15 significant digits are formatted as before.
+ * Independent of the current locale.
+ * @param value Value
+ * @param out Output buffer of at least `S_MAX_DOUBLE_CHARS` characters
+ * @return Number of characters written
+ */
+GT_DATAMODEL_EXPORT int formatDouble(double value, QChar* out);
+
+/**
+ * @brief Parses a double. Simple decimal numbers are converted directly,
+ * anything else is converted using QString::toDouble.
+ * @param begin Begin of the string
+ * @param end End of the string
+ * @return Value (0 if the string is not a valid number)
+ */
+GT_DATAMODEL_EXPORT double parseDouble(const QChar* begin, const QChar* end);
+
+/**
+ * @brief Converts the lists into the ';' separated format of property lists
+ * @param list List
+ * @return List as string
+ */
+GT_DATAMODEL_EXPORT QString listToString(const QVector<double>& list);
+GT_DATAMODEL_EXPORT QString listToString(const QList<int>& list);
+GT_DATAMODEL_EXPORT QString listToString(const QList<bool>& list);
+GT_DATAMODEL_EXPORT QString listToString(const QList<QPointF>& list);
+
+/**
+ * @brief Reads the lists from the ';' separated format of property lists.
+ * Empty entries are skipped, except for point lists. Very long double
+ * lists are parsed in parallel.
+ * @param str List as string
+ * @return List
+ */
+GT_DATAMODEL_EXPORT QVector<double> doubleListFromString(const QString& str);
+GT_DATAMODEL_EXPORT QList<int> intListFromString(const QString& str);
+GT_DATAMODEL_EXPORT QList<bool> boolListFromString(const QString& str);
+GT_DATAMODEL_EXPORT QList<QPointF> pointListFromString(const QString& str);
+
+} // namespace detail
+
+} // namespace gt
+
+#endif // GT_INTERNAL_LISTCONVERSION_H
@@ -8,6 +8,8 @@
 
 #include "varianthasher.h"
 
+#include <QVector>
+
 namespace gt
 {
     namespace detail
@@ -50,6 +52,71 @@ namespace gt
             }
         }
 
+        void VariantHasher::addToHash(FastHash& hash,
+                                      const QVariant& variant)
+        {
+            static int const type_QVectorDouble =
+                qMetaTypeId<QVector<double>>();
+
+            int const type = variant.userType();
+
+            switch (type)
+            {
+            case QMetaType::QString:
+            {
+                // we don't distinguish between empty and null strings!
+                QString const& str =
+                    *static_cast<const QString*>(variant.constData());
+                hash.addValue(str.size());
+                hash.addData(reinterpret_cast<const char*>(str.constData()),
+                             str.size() * int(sizeof(QChar)));
+                return;
+            }
+            case QMetaType::QStringList:
+            {
+                auto const& strList =
+                    *static_cast<const QStringList*>(variant.constData());
+                hash.addValue(strList.size());
+                for (const QString& str : strList)
+                {
+                    hash.addValue(str.size());
+                    hash.addData(reinterpret_cast<const char*>(str.constData()),
+                                 str.size() * int(sizeof(QChar)));
+                }
+                return;
+            }
+            case QMetaType::Double:
+                hash.addValue(type);
+                hash.addValue(*static_cast<const double*>(variant.constData()));
+                return;
+            case QMetaType::Int:
+                hash.addValue(type);
+                hash.addValue(*static_cast<const int*>(variant.constData()));
+                return;
+            case QMetaType::Bool:
+                hash.addValue(type);
+                hash.addValue(*static_cast<const bool*>(variant.constData()));
+                return;
+            default:
+                break;
+            }
+
+            if (type == type_QVectorDouble)
+            {
+                auto const& vec =
+                    *static_cast<const QVector<double>*>(variant.constData());
+                hash.addValue(type);
+                hash.addValue(vec.size());
+                hash.addData(reinterpret_cast<const char*>(vec.constData()),
+                             vec.size() * int(sizeof(double)));
+                return;
+            }
+
+            buff.seek(0);
+            ds << variant;
+            hash.addData(bb.constData(), buff.pos());
+        }
+
 
     } // namespace detail
 } // namespace gt
@@ -10,6 +10,7 @@
 #define GT_INTERNAL_VARIANTHASHER_H
 
 #include "gt_datamodel_exports.h"
+#include "gt_fasthash.h"
 
 #include <QCryptographicHash>
 #include <QBuffer>
@@ -31,6 +32,14 @@ namespace gt
             GT_DATAMODEL_EXPORT void addToHash(QCryptographicHash& hash,
                                                const QVariant& variant);
 
+            /**
+             * @brief Adds the variant to a fast hash. Common types (numbers,
+             * strings and double vectors) are hashed directly, other types
+             * are serialized using a data stream.
+             */
+            GT_DATAMODEL_EXPORT void addToHash(FastHash& hash,
+                                               const QVariant& variant);
+
         private:
             QByteArray bb;
             QBuffer buff;
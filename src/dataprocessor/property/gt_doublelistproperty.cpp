@@ -23,18 +23,34 @@ GtDoubleListProperty::GtDoubleListProperty(const QString& ident,
     m_initValue = m_value;
 }
 
+GtDoubleListProperty::GtDoubleListProperty(const QString& ident,
+                                           const QString& name,
+                                           const QString& brief,
+                                           GtUnit::Category unitCategory,
+                                           const QVector<double>& value)
+{
+    setObjectName(name);
+
+    m_id = ident;
+    m_brief = brief;
+    m_unitCategory = unitCategory;
+    m_value = value;
+    m_initValue = m_value;
+}
+
 QVariant
-GtDoubleListProperty::valueToVariant(const QString& /*unit*/,
+GtDoubleListProperty::valueToVariant(const QString& unit,
                                      bool* success) const
 {
-    QVariant variant = QVariant::fromValue(m_value);
+    bool ok = false;
+    QVariant variant = QVariant::fromValue(getVal(unit, &ok));
 
-    return gt::valueSuccess(variant, success);
+    return gt::valueSetSuccess(variant, ok, success);
 }
 
 bool
 GtDoubleListProperty::setValueFromVariant(const QVariant& val,
-                                          const QString& /*unit*/)
+                                          const QString& unit)
 {
     if (!val.canConvert<QVariantList>()) return false;
 
@@ -53,8 +69,8 @@ GtDoubleListProperty::setValueFromVariant(const QVariant& val,
         }
     }
 
-    bool ok = false;;
-    setVal(vec, &ok);
+    bool ok = false;
+    setVal(vec, unit, &ok);
     return ok;
 }
 
@@ -101,6 +117,55 @@ GtDoubleListProperty::setValueFromString(const QString& val)
     return success;
 }
 
+QVector<double>
+GtDoubleListProperty::convertFrom(const QVector<double>& value,
+                                  const QString& unit,
+                                  bool* success)
+{
+    // values without unit category are not converted
+    if (m_unitCategory == GtUnit::None)
+    {
+        return gt::valueSuccess(value, success);
+    }
+
+    bool ok = false;
+    auto const conv =
+        GtUnitConverter<double>::instance().conversion(m_unitCategory,
+                                                       unit, &ok);
+    if (!ok)
+    {
+        return gt::valueError(value, success);
+    }
+
+    QVector<double> retval(value.size());
+    conv.from(value.constData(), retval.data(), value.size());
+
+    return gt::valueSuccess(retval, success);
+}
+
+QVector<double>
+GtDoubleListProperty::convertTo(const QString& unit, bool* success) const
+{
+    if (m_unitCategory == GtUnit::None)
+    {
+        return gt::valueSuccess(m_value, success);
+    }
+
+    bool ok = false;
+    auto const conv =
+        GtUnitConverter<double>::instance().conversion(m_unitCategory,
+                                                       unit, &ok);
+    if (!ok)
+    {
+        return gt::valueError(m_value, success);
+    }
+
+    QVector<double> retval(m_value.size());
+    conv.to(m_value.constData(), retval.data(), m_value.size());
+
+    return gt::valueSuccess(retval, success);
+}
+
 gt::PropertyFactoryFunction
 gt::makeDoubleListProperty()
 {
@@ -33,6 +33,20 @@ public:
     GtDoubleListProperty(const QString& ident,
                          const QString& name);
 
+    /**
+     * @brief Constructor.
+     * @param ident Property identification string.
+     * @param name Property name visible within property browser.
+     * @param brief Property description.
+     * @param unitCategory Unit category of the values.
+     * @param value Initial values.
+     */
+    GtDoubleListProperty(const QString& ident,
+                         const QString& name,
+                         const QString& brief,
+                         GtUnit::Category unitCategory,
+                         const QVector<double>& value = {});
+
     /**
      * @brief valueToVariant
      * @return
@@ -62,6 +76,28 @@ public:
      */
     bool setValueFromString(const QString& val);
 
+protected:
+    /**
+     * @brief Converts the values from the given unit to the si unit of the
+     * unit category. All values are converted at once.
+     * @param value Values in the given unit
+     * @param unit Unit
+     * @param success Whether the conversion was successful
+     * @return Values in si unit
+     */
+    QVector<double> convertFrom(const QVector<double>& value,
+                                const QString& unit,
+                                bool* success = nullptr) override;
+
+    /**
+     * @brief Converts the values to the given unit
+     * @param unit Unit
+     * @param success Whether the conversion was successful
+     * @return Values in the given unit
+     */
+    QVector<double> convertTo(const QString& unit,
+                              bool* success = nullptr) const override;
+
 };
 
 namespace gt
@@ -22,6 +22,43 @@ template<class T>
 class GtUnitConverter
 {
 public:
+    /**
+     * @brief Pre-resolved conversion between the si unit of a category and
+     * another unit of this category. Resolve it once using `conversion` and
+     * reuse it to avoid looking up the unit for each value.
+     * Values are converted to the unit by `value * factor + summand`.
+     */
+    struct Conversion
+    {
+        /// Factor from si unit to unit
+        double factor = 1.0;
+        /// Summand from si unit to unit
+        double summand = 0.0;
+        /// Whether the unit was found
+        bool valid = false;
+
+        bool isValid() const { return valid; }
+
+        /// Converts a value from the si unit to the unit
+        T to(T value) const { return value * factor + summand; }
+
+        /// Converts a value from the unit to the si unit
+        T from(T value) const { return (value - summand) / factor; }
+
+        /**
+         * @brief Converts `n` values from the si unit to the unit. The loop
+         * is kept simple to allow the compiler to vectorize it.
+         * `in` and `out` may be the same.
+         */
+        void to(const T* in, T* out, int n) const;
+
+        /**
+         * @brief Converts `n` values from the unit to the si unit.
+         * `in` and `out` may be the same.
+         */
+        void from(const T* in, T* out, int n) const;
+    };
+
     static GtUnitConverter& instance();
 
     T from(GtUnit::Category category, const QString &GtUnit,
@@ -30,6 +67,17 @@ public:
     T To(GtUnit::Category category, const QString &GtUnit,
          T value, bool* success = nullptr);
 
+    /**
+     * @brief Resolves the conversion between the si unit of the category and
+     * the given unit.
+     * @param category Unit category
+     * @param unit Unit
+     * @param success Whether the unit was found
+     * @return Conversion (invalid if the unit was not found)
+     */
+    Conversion conversion(GtUnit::Category category, const QString& unit,
+                          bool* success = nullptr) const;
+
     /**
      * @brief Returns a list of all unit names for a given category.
      * @return
@@ -68,13 +116,10 @@ template<class T>
 QStringList
 GtUnitConverter<T>::units(GtUnit::Category category) const
 {
-    QMap<QString, double> const factors = m_factorMap[category];
-    QMap<QString, double> const summands = m_summandMap[category];
-
     QStringList retval;
 
-    retval.append(factors.keys());
-    retval.append(summands.keys());
+    retval.append(m_factorMap.value(category).keys());
+    retval.append(m_summandMap.value(category).keys());
 
     retval.removeDuplicates();
 
@@ -82,69 +127,103 @@ GtUnitConverter<T>::units(GtUnit::Category category) const
 }
 
 template<class T>
-T GtUnitConverter<T>::from(GtUnit::Category category, const QString& GtUnit,
-                           T value, bool* success)
+typename GtUnitConverter<T>::Conversion
+GtUnitConverter<T>::conversion(GtUnit::Category category,
+                               const QString& unit, bool* success) const
 {
-    QMap<QString, double> const factors = m_factorMap[category];
-    QMap<QString, double> const summands = m_summandMap[category];
+    Conversion conv;
 
-    bool const hasFac = factors.contains(GtUnit);
-    bool const hasSum = summands.contains(GtUnit);
+    auto const factors = m_factorMap.constFind(category);
+    if (factors != m_factorMap.constEnd())
+    {
+        auto const factor = factors->constFind(unit);
+        if (factor != factors->constEnd())
+        {
+            assert(*factor != 0);
+            conv.factor = *factor;
+            conv.valid = true;
+        }
+    }
 
-    if (!hasFac && !hasSum)
+    auto const summands = m_summandMap.constFind(category);
+    if (summands != m_summandMap.constEnd())
+    {
+        auto const summand = summands->constFind(unit);
+        if (summand != summands->constEnd())
+        {
+            conv.summand = *summand;
+            conv.valid = true;
+        }
+    }
+
+    if (!conv.valid)
     {
         gtWarning().nospace()
-                << QObject::tr("No such unit") << " (" << GtUnit << ") "
+                << QObject::tr("No such unit") << " (" << unit << ") "
                 << QObject::tr("in category") << " ("
                 << GtUnit::categoryToString(category)
                 << ") - "
                 << QObject::tr("No conversion done!");
-        return gt::valueError(value, success);
+        return gt::valueError(conv, success);
     }
 
-    if (hasSum)
+    return gt::valueSuccess(conv, success);
+}
+
+template<class T>
+void
+GtUnitConverter<T>::Conversion::to(const T* in, T* out, int n) const
+{
+    double const fac = factor;
+    double const sum = summand;
+
+    for (int i = 0; i < n; ++i)
     {
-        value = value - summands[GtUnit];
+        out[i] = in[i] * fac + sum;
     }
-    if (hasFac)
+}
+
+template<class T>
+void
+GtUnitConverter<T>::Conversion::from(const T* in, T* out, int n) const
+{
+    double const fac = factor;
+    double const sum = summand;
+
+    for (int i = 0; i < n; ++i)
     {
-        assert(factors[GtUnit] != 0);
-        value = value / factors[GtUnit];
+        out[i] = (in[i] - sum) / fac;
     }
-    return gt::valueSuccess(value, success);
 }
 
 template<class T>
-T GtUnitConverter<T>::To(GtUnit::Category category,
-                         const QString &GtUnit, T value, bool *success)
+T GtUnitConverter<T>::from(GtUnit::Category category, const QString& GtUnit,
+                           T value, bool* success)
 {
-    QMap<QString, double> const factors = m_factorMap[category];
-    QMap<QString, double> const summands = m_summandMap[category];
-
-    bool const hasFac = factors.contains(GtUnit);
-    bool const hasSum = summands.contains(GtUnit);
+    bool ok = false;
+    Conversion const conv = conversion(category, GtUnit, &ok);
 
-    if (!hasFac && !hasSum)
+    if (!ok)
     {
-        gtWarning().nospace()
-                << QObject::tr("No such unit") << " (" << GtUnit << ") "
-                << QObject::tr("in category") << " ("
-                << GtUnit::categoryToString(category)
-                << ") - "
-                << QObject::tr("No conversion done!");
         return gt::valueError(value, success);
     }
 
-    if (hasFac)
-    {
-        value = value * factors[GtUnit];
-    }
-    if (hasSum)
+    return gt::valueSuccess(conv.from(value), success);
+}
+
+template<class T>
+T GtUnitConverter<T>::To(GtUnit::Category category,
+                         const QString &GtUnit, T value, bool *success)
+{
+    bool ok = false;
+    Conversion const conv = conversion(category, GtUnit, &ok);
+
+    if (!ok)
     {
-        value = value + summands[GtUnit];
+        return gt::valueError(value, success);
     }
 
-    return gt::valueSuccess(value, success);
+    return gt::valueSuccess(conv.to(value), success);
 }
 
 template<class T>
@@ -144,7 +144,8 @@ GtCollectionLoader::downloadCollectionItems(
                 url.setUrl(QString(urlStr + QStringLiteral("/") + filename));
             }
 
-            dialog.addFileDownload(url, target, filename);
+            dialog.addFileDownload(url, target, filename,
+                                   item.fileChecksum(filename));
         }
     }
 
@@ -352,6 +353,15 @@ GtCollectionLoader::readNetworkItemInformation(const QUrl& url,
     retval.m_files = fileNames;
     retval.m_url = url;
 
+    QJsonObject checksums = json[QStringLiteral("sha256")].toObject();
+
+    for (auto iter = checksums.constBegin(); iter != checksums.constEnd();
+         ++iter)
+    {
+        retval.m_checksums.insert(iter.key(),
+                                  iter.value().toString().toLatin1());
+    }
+
     QMap<QString, QMetaType::Type> colStruct =
         m_collection->collectionStructure();
 
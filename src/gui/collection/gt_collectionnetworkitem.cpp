@@ -28,3 +28,9 @@ GtCollectionNetworkItem::url() const
 {
     return m_url;
 }
+
+QByteArray
+GtCollectionNetworkItem::fileChecksum(const QString& fileName) const
+{
+    return m_checksums.value(fileName);
+}
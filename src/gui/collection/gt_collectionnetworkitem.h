@@ -43,6 +43,14 @@ public:
      */
     QUrl url() const;
 
+    /**
+     * @brief Returns the SHA-256 checksum of the given file as listed in the
+     * optional "sha256" object of the item information
+     * @param fileName File name
+     * @return Checksum (hex encoded). Empty if not listed
+     */
+    QByteArray fileChecksum(const QString& fileName) const;
+
 private:
     /// Installed version.
     double m_installedVersion;
@@ -50,6 +58,9 @@ private:
     /// Network access data to collection item
     QUrl m_url;
 
+    /// Checksums of the files
+    QMap<QString, QByteArray> m_checksums;
+
 };
 
 #endif // GT_COLLECTIONNETWORKITEM_H
@@ -25,10 +25,15 @@ bool
 GtProcessFilterModel::filterAcceptsRow(int source_row,
                                        const QModelIndex& source_parent) const
 {
-    return GtTreeFilterModel::filterAcceptsRow(source_row, source_parent,
-                                               [](GtObject* obj)
-    {
-        return qobject_cast<GtTask*>(obj) || qobject_cast<GtCalculator*>(obj) ||
-               qobject_cast<GtTaskGroup*>(obj) || obj->isDummy();
-    });
+    return filterAcceptsIndexedRow(source_row, source_parent);
+}
+
+bool
+GtProcessFilterModel::acceptsSourceIndex(const QModelIndex& source_index) const
+{
+    GtObject* obj = static_cast<GtObject*>(source_index.internalPointer());
+    assert(obj);
+
+    return qobject_cast<GtTask*>(obj) || qobject_cast<GtCalculator*>(obj) ||
+           qobject_cast<GtTaskGroup*>(obj) || obj->isDummy();
 }
@@ -38,6 +38,13 @@ protected:
     bool filterAcceptsRow(int source_row,
                           const QModelIndex& source_parent) const override;
 
+    /**
+     * @brief Accepts tasks, calculators, task groups and unknown objects
+     * @param source_index
+     * @return
+     */
+    bool acceptsSourceIndex(const QModelIndex& source_index) const override;
+
 };
 
 #endif // GTPROCESSFILTERMODEL_H
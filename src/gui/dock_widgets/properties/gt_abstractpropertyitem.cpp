@@ -138,5 +138,5 @@ GtAbstractPropertyItem::updateSubProperties()
 void
 GtAbstractPropertyItem::onPropertyChange()
 {
-    emit dataChanged(this, m_property);
+    notifyDataChanged(m_property);
 }
@@ -515,7 +515,10 @@ GtApplication::startCommand(GtObject* root, const QString& commandId)
         return GtCommand();
     }
 
-    m_d->m_commandMemento = GtObjectMemento(root);
+    // the memento of the root is kept between commands. Changes made since
+    // the last command are applied to it here, hence they are not part of
+    // this command. Unsignaled changes are detected by the hash check.
+    m_d->m_commandCache.commit(*root);
     m_d->m_commandRoot = root;
     m_d->m_commandId = commandId;
     m_d->m_commandUuid = QUuid::createUuid().toString();
@@ -557,9 +560,9 @@ GtApplication::endCommand(const GtCommand& command)
         return;
     }
 
-    GtObjectMemento newMemento = m_d->m_commandRoot->toMemento();
-
-    GtObjectMementoDiff diff(m_d->m_commandMemento, newMemento);
+    // only the objects changed by the command are compared
+    GtObjectMementoDiff diff =
+        m_d->m_commandCache.commit(*m_d->m_commandRoot);
 
     gtDebug().verbose() << "######## COMMAND END! (" << m_d->m_commandId << ")";
 
@@ -573,7 +576,7 @@ GtApplication::endCommand(const GtCommand& command)
     auto* changeCmd = new GtMementoChangeCommand(diff, m_d->m_commandId, root);
     undoStack()->push(changeCmd);
 
-    // cleanup
+    // cleanup, the memento of the root is kept for the next command
     m_d->m_commandRoot = nullptr;
     m_d->m_commandId = QString();
 
@@ -15,7 +15,7 @@
 #include <QObject>
 #include <QPointer>
 
-#include "gt_objectmemento.h"
+#include "gt_objectmementocache.h"
 
 /**
  * @brief The GtApplicationPrivate class
@@ -28,9 +28,6 @@ public:
      */
     explicit GtApplicationPrivate(QObject* parent = nullptr);
 
-    /// Command object memento
-    GtObjectMemento m_commandMemento;
-
     /// Root object for command
     QPointer<GtObject> m_commandRoot;
 
@@ -40,6 +37,9 @@ public:
     /// Command identification string
     QString m_commandUuid;
 
+    /// State and change journal of the command root
+    GtObjectMementoCache m_commandCache;
+
 };
 
 #endif // GT_APPLICATIONPRIVATE_H
@@ -16,6 +16,7 @@
 #include "gt_task.h"
 #include "gt_command.h"
 #include "gt_objectmementodiff.h"
+#include "gt_objectchangebatch.h"
 #include "gt_taskrunner.h"
 #include "gt_finishedprocessloadinghelper.h"
 #include "gt_icons.h"
@@ -121,6 +122,9 @@ GtProcessExecutor::onHelperFinished()
     auto command = gtApp->makeCommand(m_source, commandMsg);
     Q_UNUSED(command)
 
+    // closed before the command ends
+    GtObjectChangeBatch batch;
+
     if (!m_source->applyDiff(*helper->sumDiff()))
     {
             gtErrorId(GT_EXEC_ID)
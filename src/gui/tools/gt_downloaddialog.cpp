@@ -96,9 +96,11 @@ GtDownloadDialog::addFileDownload(const QString& url,
 void
 GtDownloadDialog::addFileDownload(const QUrl& url,
                                   const QString& downloadPath,
-                                  const QString& targetFileName)
+                                  const QString& targetFileName,
+                                  const QByteArray& checksum)
 {
-    m_downloader->addFileDownload(url, downloadPath, targetFileName);
+    m_downloader->addFileDownload(url, downloadPath, targetFileName,
+                                  checksum);
 }
 
 void
@@ -46,9 +46,12 @@ public:
      * @param url
      * @param downloadPath
      * @param targetFileName
+     * @param checksum Expected SHA-256 checksum (hex encoded). The file is
+     * not checked if empty
      */
     void addFileDownload(const QUrl& url, const QString& downloadPath,
-                         const QString& targetFileName = QString());
+                         const QString& targetFileName = QString(),
+                         const QByteArray& checksum = QByteArray());
 
 protected:
     /**
@@ -0,0 +1,32 @@
+# SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+#
+# SPDX-License-Identifier: MPL-2.0+
+
+#
+# Uses an installed Google Benchmark or downloads it otherwise
+#
+
+find_package(benchmark QUIET)
+
+if (NOT TARGET benchmark::benchmark)
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+    # Build benchmark as a static lib
+    set(BUILD_SHARED_LIBS OFF)
+
+    include(FetchContent)
+    FetchContent_Declare(googlebenchmark
+        GIT_REPOSITORY      https://github.com/google/benchmark.git
+        GIT_TAG             v1.8.3)
+    FetchContent_GetProperties(googlebenchmark)
+    if(NOT googlebenchmark_POPULATED)
+        FetchContent_Populate(googlebenchmark)
+        add_subdirectory(${googlebenchmark_SOURCE_DIR}
+                         ${googlebenchmark_BINARY_DIR} EXCLUDE_FROM_ALL)
+    endif()
+
+    set_target_properties(benchmark benchmark_main
+        PROPERTIES FOLDER "Extern")
+endif()
@@ -0,0 +1,36 @@
+# SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+#
+# SPDX-License-Identifier: MPL-2.0+
+
+#
+# Writes the git revision of the sources into a header. The header is only
+# rewritten if the revision changed. Runs in script mode at build time:
+#
+#   cmake -DSOURCE_DIR=<dir> -DOUTPUT_FILE=<file> [-DGIT_EXECUTABLE=<git>]
+#         -P BenchmarkRevision.cmake
+#
+
+set(REVISION "unknown")
+
+if (GIT_EXECUTABLE)
+    execute_process(COMMAND ${GIT_EXECUTABLE} rev-parse --short HEAD
+        WORKING_DIRECTORY ${SOURCE_DIR}
+        OUTPUT_VARIABLE GIT_REVISION
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+        ERROR_QUIET)
+
+    if (GIT_REVISION)
+        set(REVISION ${GIT_REVISION})
+    endif()
+endif()
+
+set(CONTENT "#define GT_BENCHMARK_REVISION \"${REVISION}\"\n")
+
+set(OLD_CONTENT "")
+if (EXISTS ${OUTPUT_FILE})
+    file(READ ${OUTPUT_FILE} OLD_CONTENT)
+endif()
+
+if (NOT "${CONTENT}" STREQUAL "${OLD_CONTENT}")
+    file(WRITE ${OUTPUT_FILE} "${CONTENT}")
+endif()
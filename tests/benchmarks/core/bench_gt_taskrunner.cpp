@@ -0,0 +1,70 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bench_tasks.h"
+#include "datamodel/bench_objects.h"
+#include "gt_taskrunner.h"
+
+namespace
+{
+
+/// Number of packages in the benchmark source
+constexpr int nPackages = 4;
+
+/// Measures set up and source data transfer of a task, which references a
+/// single object of a source containing `state.range(0)` objects
+void
+taskStartLatency(benchmark::State& state, bool linkedDataOnly)
+{
+    GtObjectGroup source;
+
+    for (int i = 0; i < nPackages; ++i)
+    {
+        auto* package = new BenchPackage;
+        package->setObjectName(QStringLiteral("Package_%1").arg(i));
+        bench::fillObjects(*package, state.range(0) / nPackages);
+        source.appendChild(package);
+    }
+
+    source.enableUuidIndex();
+
+    gtObjectFactory->registerClass(BenchTask::staticMetaObject);
+
+    BenchTask task;
+    task.setFactory(gtObjectFactory);
+    task.setLink(source.findChildren<BenchObject*>().last()->uuid());
+
+    for (auto _ : state)
+    {
+        BenchRunnable runnable;
+        GtTaskRunner runner(&task);
+        runner.setLinkedSourceDataOnly(linkedDataOnly);
+        runner.setUp(&runnable, &source);
+
+        runnable.run();
+        benchmark::DoNotOptimize(runnable.linkedObjects().size());
+    }
+}
+
+} // namespace
+
+static void
+BM_taskStart_fullSource(benchmark::State& state)
+{
+    taskStartLatency(state, false);
+}
+BENCHMARK(BM_taskStart_fullSource)->RangeMultiplier(10)->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
+
+static void
+BM_taskStart_linkedSource(benchmark::State& state)
+{
+    taskStartLatency(state, true);
+}
+BENCHMARK(BM_taskStart_linkedSource)->RangeMultiplier(10)->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,165 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "datamodel/bench_objects.h"
+#include "gt_objectmementodiff.h"
+#include "gt_processrunnerglobals.h"
+#include "gt_tcpframereader.h"
+
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QRegularExpression>
+
+#include <memory>
+
+namespace
+{
+
+enum Framing
+{
+    LegacyRegex, // size prefix parsed as before (copying the buffer)
+    LegacyReader, // size prefix parsed by the frame reader
+    BinaryReader // binary frames parsed by the frame reader
+};
+
+/// Connected pair of local sockets
+struct SocketPair
+{
+    QTcpServer server;
+    QTcpSocket client;
+    std::unique_ptr<QTcpSocket> peer;
+
+    bool connect()
+    {
+        if (!server.listen(QHostAddress::LocalHost)) return false;
+
+        client.connectToHost(QHostAddress::LocalHost, server.serverPort());
+        if (!client.waitForConnected(3000)) return false;
+        if (!server.waitForNewConnection(3000)) return false;
+
+        peer.reset(server.nextPendingConnection());
+        return peer != nullptr;
+    }
+};
+
+/// Creates a memento diff payload of the size of a package containing
+/// `nObjects` objects
+QByteArray
+diffPayload(int nObjects)
+{
+    BenchPackage before;
+    BenchPackage after;
+    after.setUuid(before.uuid());
+    bench::fillObjects(after, nObjects);
+
+    GtObjectMementoDiff diff(before.toMemento(), after.toMemento());
+
+    return gt::process_runner::MementoDiffPayload(diff).toMemento()
+        .toByteArray();
+}
+
+/// Baseline: reads a single size prefixed message like the former
+/// implementation of the process runner connection
+bool
+readLegacy(QByteArray& buffer, QByteArray& data)
+{
+    static QRegularExpression regex{R"(^\d+)"};
+
+    QRegularExpressionMatch match = regex.match(buffer);
+    auto captured = match.captured();
+    int size = captured.toInt();
+
+    data = buffer.mid(captured.size(), size);
+    if (data.size() != size) return false;
+
+    buffer.remove(0, captured.size() + size);
+    return true;
+}
+
+/// Measures sending and receiving a memento diff payload of multiple MB
+/// over a local socket
+void
+tcpThroughput(benchmark::State& state, Framing framing)
+{
+    SocketPair sockets;
+    if (!sockets.connect())
+    {
+        state.SkipWithError("Failed to connect local sockets");
+        return;
+    }
+
+    QByteArray const payload = diffPayload(state.range(0));
+    QByteArray const header = framing == BinaryReader ?
+        gt::tcp::frameHeader(gt::tcp::DataFrame, payload.size()) :
+        QByteArray::number(payload.size());
+
+    QTcpSocket& sender = *sockets.peer;
+    QTcpSocket& receiver = sockets.client;
+
+    GtTcpFrameReader reader;
+    QByteArray buffer;
+
+    for (auto _ : state)
+    {
+        sender.write(header);
+        sender.write(payload);
+
+        bool done = false;
+        QByteArray data;
+
+        while (!done)
+        {
+            sender.flush();
+            receiver.waitForReadyRead(100);
+
+            if (framing == LegacyRegex)
+            {
+                buffer += receiver.readAll();
+                done = readLegacy(buffer, data);
+                continue;
+            }
+
+            reader.append(receiver.readAll());
+
+            GtTcpFrameReader::Frame frame;
+            done = reader.readFrame(frame) == GtTcpFrameReader::FrameRead;
+            data = frame.payload;
+        }
+
+        benchmark::DoNotOptimize(data.constData());
+    }
+
+    state.SetBytesProcessed(state.iterations() *
+                            (header.size() + payload.size()));
+}
+
+} // namespace
+
+static void
+BM_tcpThroughput_legacyRegex(benchmark::State& state)
+{
+    tcpThroughput(state, LegacyRegex);
+}
+BENCHMARK(BM_tcpThroughput_legacyRegex)->RangeMultiplier(10)
+    ->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+static void
+BM_tcpThroughput_legacyReader(benchmark::State& state)
+{
+    tcpThroughput(state, LegacyReader);
+}
+BENCHMARK(BM_tcpThroughput_legacyReader)->RangeMultiplier(10)
+    ->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+static void
+BM_tcpThroughput_binaryReader(benchmark::State& state)
+{
+    tcpThroughput(state, BinaryReader);
+}
+BENCHMARK(BM_tcpThroughput_binaryReader)->RangeMultiplier(10)
+    ->Range(1000, 100000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,68 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef BENCH_TASKS_H
+#define BENCH_TASKS_H
+
+#include <QDir>
+
+#include "gt_task.h"
+#include "gt_abstractrunnable.h"
+#include "gt_objectlinkproperty.h"
+#include "gt_objectfactory.h"
+
+/**
+ * @brief Task referencing a single datamodel object
+ */
+class BenchTask : public GtTask
+{
+    Q_OBJECT
+
+public:
+    Q_INVOKABLE BenchTask() :
+        m_link("link", "Link", "Link", this, QStringList{})
+    {
+        registerProperty(m_link);
+    }
+
+    /// Sets the uuid of the linked object
+    void setLink(const QString& uuid)
+    {
+        m_link.setVal(uuid);
+    }
+
+private:
+    GtObjectLinkProperty m_link;
+};
+
+/**
+ * @brief Runnable, which only restores the transferred source data
+ */
+class BenchRunnable : public GtAbstractRunnable
+{
+    Q_OBJECT
+
+public:
+    void run() override
+    {
+        for (GtObjectMemento& memento : m_inputData)
+        {
+            if (GtObject* obj = memento.restore(gtObjectFactory))
+            {
+                obj->enableUuidIndex();
+                m_linkedObjects.append(obj);
+            }
+        }
+    }
+
+    QDir tempDir() override { return QDir::temp(); }
+
+    bool clearTempDir(const QString&) override { return true; }
+
+    QString projectPath() override { return {}; }
+};
+
+#endif // BENCH_TASKS_H
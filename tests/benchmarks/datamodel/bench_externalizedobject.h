@@ -0,0 +1,98 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef BENCH_EXTERNALIZEDOBJECT_H
+#define BENCH_EXTERNALIZEDOBJECT_H
+
+#include "gt_externalizedobject.h"
+
+#include <QVector>
+
+class BenchExternalizedObject;
+
+/**
+ * @brief Data class of the externalized benchmark object
+ */
+class BenchExternalizedObjectData : public GtExternalizedObjectData
+{
+    GT_DECL_BASECLASS(BenchExternalizedObject)
+
+public:
+
+    explicit BenchExternalizedObjectData(BenchExternalizedObject* base);
+
+    const QVector<double>& values() const;
+
+    void setValues(const QVector<double>& values) &;
+};
+
+/**
+ * @brief Externalized object used by the benchmarks. The data is
+ * externalized into memory, thus only the overhead of fetching and
+ * releasing is measured.
+ */
+class BenchExternalizedObject : public GtExternalizedObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QVector<double> values MEMBER m_values)
+
+    GT_DECL_DATACLASS(BenchExternalizedObjectData)
+
+public:
+
+    Q_INVOKABLE BenchExternalizedObject() = default;
+
+    /// Tracks modifications instead of comparing hashes
+    void trackModifications() { enableModificationTracking(); }
+
+protected:
+
+    bool doFetchData(QVariant& /*metaData*/, bool /*fetchInitialVersion*/) override
+    {
+        m_values = m_externalized;
+        return true;
+    }
+
+    bool doExternalizeData(QVariant& /*metaData*/) override
+    {
+        m_externalized = m_values;
+        return true;
+    }
+
+    void doClearExternalizedData() override
+    {
+        m_values.clear();
+    }
+
+private:
+
+    QVector<double> m_values;
+
+    /// externalized data
+    QVector<double> m_externalized;
+};
+
+inline
+BenchExternalizedObjectData::BenchExternalizedObjectData(
+        BenchExternalizedObject* base) :
+    GtExternalizedObjectData{base}
+{ }
+
+inline const QVector<double>&
+BenchExternalizedObjectData::values() const
+{
+    return base()->m_values;
+}
+
+inline void
+BenchExternalizedObjectData::setValues(const QVector<double>& values) &
+{
+    base()->m_values = values;
+    setModified();
+}
+
+#endif // BENCH_EXTERNALIZEDOBJECT_H
@@ -0,0 +1,80 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bench_externalizedobject.h"
+#include "gt_externalizationmanager.h"
+
+/*
+ * Benchmarks of fetching and releasing the data of an externalized object.
+ * All benchmarks take the argument
+ *   megabytes: size of the data
+ */
+
+namespace
+{
+
+void
+dataSizes(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"megabytes"});
+
+    for (int n : {1, 10, 100})
+    {
+        b->Args({n});
+    }
+
+    b->Unit(benchmark::kMillisecond);
+}
+
+void
+fetchRelease(benchmark::State& state, bool trackModifications)
+{
+    gtExternalizationManager->enableExternalization(true);
+
+    int const size = static_cast<int>(state.range(0) * 1024 * 1024 /
+                                      static_cast<int>(sizeof(double)));
+
+    BenchExternalizedObject obj;
+    if (trackModifications) obj.trackModifications();
+
+    {
+        auto data = obj.fetchData();
+        data.setValues(QVector<double>(size, 1.0));
+    }
+
+    // the data is externalized once as when saving a project
+    if (!obj.externalize() || obj.isFetched())
+    {
+        state.SkipWithError("Failed to externalize the data");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        auto data = obj.fetchData();
+        benchmark::DoNotOptimize(data.values().size());
+    }
+
+    state.SetBytesProcessed(state.iterations() * size * sizeof(double));
+}
+
+} // namespace
+
+static void
+BM_fetchRelease_hashed(benchmark::State& state)
+{
+    fetchRelease(state, false);
+}
+BENCHMARK(BM_fetchRelease_hashed)->Apply(dataSizes);
+
+static void
+BM_fetchRelease_tracked(benchmark::State& state)
+{
+    fetchRelease(state, true);
+}
+BENCHMARK(BM_fetchRelease_tracked)->Apply(dataSizes);
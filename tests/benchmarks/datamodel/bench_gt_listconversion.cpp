@@ -0,0 +1,266 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "internal/gt_listconversion.h"
+
+#include <QStringList>
+#include <QVariant>
+
+#include <cfloat>
+#include <random>
+#include <type_traits>
+
+namespace
+{
+
+/// Baseline: list conversions as formerly implemented in GtObjectIO
+namespace legacy
+{
+
+QString
+toString(const QVector<double>& t)
+{
+    QString str;
+    str.reserve(t.size() * (DBL_DIG + 2));
+
+    for (double m : t)
+    {
+        str.append(QString::number(m, 'g', DBL_DIG)).append(';');
+    }
+    str.truncate(str.size() - 1);
+
+    return str;
+}
+
+QString
+toString(const QList<int>& t)
+{
+    QString str;
+    str.reserve(t.size() * 5);
+
+    for (int m : t)
+    {
+        str += QString::number(m) + ";";
+    }
+    str.truncate(str.size() - 1);
+
+    return str;
+}
+
+QString
+toString(const QList<bool>& t)
+{
+    QString str;
+    str.reserve(t.size() * 6);
+
+    for (bool m : t)
+    {
+        str += m ? QStringLiteral("true;") : QStringLiteral("false;");
+    }
+    str.truncate(str.size() - 1);
+
+    return str;
+}
+
+QString
+toString(const QList<QPointF>& t)
+{
+    QString str;
+    str.reserve(2 * t.size() * (DBL_DIG + 2));
+
+    for (QPointF const& m : t)
+    {
+        str.append(QString::number(m.x(), 'g', DBL_DIG)).append("_").append(
+                    QString::number(m.y(), 'g', DBL_DIG)).append(';');
+    }
+    str.truncate(str.size() - 1);
+
+    return str;
+}
+
+void
+fromString(const QString& value, QVector<double>& list)
+{
+    QVector<QStringRef> strList =
+            QStringRef(&value).split(';', Qt::SkipEmptyParts);
+    list.reserve(strList.size());
+
+    for (const auto& val : strList)
+    {
+        list.append(val.toDouble());
+    }
+}
+
+void
+fromString(const QString& value, QList<int>& list)
+{
+    QVector<QStringRef> strList =
+            QStringRef(&value).split(';', Qt::SkipEmptyParts);
+    list.reserve(strList.size());
+
+    for (const auto& val : strList)
+    {
+        list.append(val.toInt());
+    }
+}
+
+void
+fromString(const QString& value, QList<bool>& list)
+{
+    QVector<QStringRef> strList =
+            QStringRef(&value).split(';', Qt::SkipEmptyParts);
+    list.reserve(strList.size());
+
+    for (const auto& val : strList)
+    {
+        list.append(QVariant(val.toString()).toBool());
+    }
+}
+
+void
+fromString(const QString& value, QList<QPointF>& list)
+{
+    QStringList values = value.split(QStringLiteral(";"));
+
+    for (const QString& val : values)
+    {
+        QStringList pvars = val.split(QStringLiteral("_"));
+
+        if (pvars.size() == 2)
+        {
+            list << QPointF(pvars[0].toDouble(), pvars[1].toDouble());
+        }
+    }
+}
+
+} // namespace legacy
+
+void
+fromString(const QString& value, QVector<double>& list)
+{
+    list = gt::detail::doubleListFromString(value);
+}
+
+void
+fromString(const QString& value, QList<int>& list)
+{
+    list = gt::detail::intListFromString(value);
+}
+
+void
+fromString(const QString& value, QList<bool>& list)
+{
+    list = gt::detail::boolListFromString(value);
+}
+
+void
+fromString(const QString& value, QList<QPointF>& list)
+{
+    list = gt::detail::pointListFromString(value);
+}
+
+/// Creates a list of `n` random values
+template <typename List>
+List
+randomList(int n)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-1e3, 1e3);
+
+    List list;
+    list.reserve(n);
+
+    for (int i = 0; i < n; ++i)
+    {
+        list.append(static_cast<typename List::value_type>(
+                        std::is_same<List, QList<bool>>::value ?
+                            dist(rng) > 0.0 : dist(rng)));
+    }
+
+    return list;
+}
+
+template <>
+QList<QPointF>
+randomList<QList<QPointF>>(int n)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-1e3, 1e3);
+
+    QList<QPointF> list;
+    list.reserve(n);
+
+    for (int i = 0; i < n; ++i)
+    {
+        double x = dist(rng);
+        list.append(QPointF(x, dist(rng)));
+    }
+
+    return list;
+}
+
+template <typename List>
+void
+listToString(benchmark::State& state, bool useLegacy)
+{
+    List const list = randomList<List>(state.range(0));
+
+    for (auto _ : state)
+    {
+        QString str = useLegacy ? legacy::toString(list) :
+                                  gt::detail::listToString(list);
+        benchmark::DoNotOptimize(str.constData());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void
+listFromString(benchmark::State& state, bool useLegacy)
+{
+    QString const str = legacy::toString(randomList<List>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        List list;
+        if (useLegacy) legacy::fromString(str, list);
+        else fromString(str, list);
+
+        benchmark::DoNotOptimize(list);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * str.size() * sizeof(QChar));
+}
+
+} // namespace
+
+#define GT_BENCH_LIST_CONVERSION(NAME, LIST) \
+    static void BM_listToString_##NAME##_legacy(benchmark::State& state) \
+    { listToString<LIST>(state, true); } \
+    BENCHMARK(BM_listToString_##NAME##_legacy)->RangeMultiplier(10) \
+        ->Range(1000, 10000000)->Unit(benchmark::kMillisecond); \
+    static void BM_listToString_##NAME(benchmark::State& state) \
+    { listToString<LIST>(state, false); } \
+    BENCHMARK(BM_listToString_##NAME)->RangeMultiplier(10) \
+        ->Range(1000, 10000000)->Unit(benchmark::kMillisecond); \
+    static void BM_listFromString_##NAME##_legacy(benchmark::State& state) \
+    { listFromString<LIST>(state, true); } \
+    BENCHMARK(BM_listFromString_##NAME##_legacy)->RangeMultiplier(10) \
+        ->Range(1000, 10000000)->Unit(benchmark::kMillisecond); \
+    static void BM_listFromString_##NAME(benchmark::State& state) \
+    { listFromString<LIST>(state, false); } \
+    BENCHMARK(BM_listFromString_##NAME)->RangeMultiplier(10) \
+        ->Range(1000, 10000000)->Unit(benchmark::kMillisecond) \
+        ->UseRealTime();
+
+GT_BENCH_LIST_CONVERSION(double, QVector<double>)
+GT_BENCH_LIST_CONVERSION(int, QList<int>)
+GT_BENCH_LIST_CONVERSION(bool, QList<bool>)
+GT_BENCH_LIST_CONVERSION(pointF, QList<QPointF>)
@@ -0,0 +1,326 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bench_objects.h"
+#include "gt_objectmemento.h"
+#include "gt_objectchangedispatcher.h"
+
+#include <QFile>
+
+#include <memory>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+/*
+ * Benchmarks of creating, loading and changing large numbers of objects.
+ * All benchmarks take the argument
+ *   objects: number of objects
+ *
+ * The create and load benchmarks run once, as they report the resident
+ * memory per object (Linux only). The `_eagerUuid` and `_stringUuids`
+ * variants are the baselines of lazily generated 128 bit uuids.
+ *
+ * The uuid lookup and tree building benchmarks compare trees with and
+ * without uuid index.
+ */
+
+namespace
+{
+
+void
+objectCounts(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"objects"});
+
+    for (int n : {10000, 100000, 1000000})
+    {
+        b->Args({n});
+    }
+
+    b->Unit(benchmark::kMillisecond);
+}
+
+/// Single run per object count, the memory of a cold run is measured
+void
+coldRun(benchmark::internal::Benchmark* b)
+{
+    objectCounts(b);
+    b->Iterations(1);
+}
+
+/// Returns the resident memory of the process in bytes (0 if unknown)
+double
+residentMemory()
+{
+#ifdef Q_OS_LINUX
+    QFile file(QStringLiteral("/proc/self/statm"));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return 0.;
+    }
+
+    QList<QByteArray> fields = file.readAll().split(' ');
+    return fields.value(1).toDouble() * sysconf(_SC_PAGESIZE);
+#else
+    return 0.;
+#endif
+}
+
+} // namespace
+
+namespace
+{
+
+/// Creates objects with two levels of parents
+void
+createObjects(benchmark::State& state, bool eagerUuid)
+{
+    int const n = static_cast<int>(state.range(0));
+
+    for (auto _ : state)
+    {
+        GtObjectGroup root;
+
+        double const before = residentMemory();
+
+        for (int i = 0; i < n / 100; ++i)
+        {
+            auto* group = new GtObjectGroup(&root);
+            if (eagerUuid) benchmark::DoNotOptimize(group->uuid());
+
+            for (int j = 0; j < 99; ++j)
+            {
+                auto* obj = new GtObjectGroup(group);
+                if (eagerUuid) benchmark::DoNotOptimize(obj->uuid());
+            }
+        }
+
+        state.counters["bytesPerObject"] = (residentMemory() - before) / n;
+
+        benchmark::DoNotOptimize(root.childObjects().size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/// Replaces the uuids by uuids without braces, which are stored as strings
+void
+toStringUuids(GtObjectMemento& memento)
+{
+    QString uuid = memento.uuid();
+    memento.setUuid(uuid.mid(1, uuid.size() - 2));
+
+    for (GtObjectMemento& child : memento.childObjects)
+    {
+        toStringUuids(child);
+    }
+}
+
+/// Loads the objects of a project package from its memento
+void
+loadObjects(benchmark::State& state, bool stringUuids)
+{
+    bench::ProjectSpec spec;
+    spec.nObjects = static_cast<int>(state.range(0));
+
+    // the project is kept, hence its memory is not reused by the load
+    auto project = bench::makeProject(spec);
+    GtObjectMemento memento = project->childObjects().first()->toMemento();
+
+    if (stringUuids) toStringUuids(memento);
+
+    for (auto _ : state)
+    {
+        // objects are loaded into an indexed tree as in a project
+        GtObjectGroup root;
+        root.enableUuidIndex();
+
+        double const before = residentMemory();
+
+        GtObject* package = memento.toObject(*gtObjectFactory, &root);
+        benchmark::DoNotOptimize(package);
+
+        state.counters["bytesPerObject"] =
+            (residentMemory() - before) / spec.nObjects;
+    }
+
+    state.SetItemsProcessed(state.iterations() * spec.nObjects);
+}
+
+/// Creates a tree with `n` objects, each object has up to 10 children
+std::unique_ptr<GtObject>
+makeTree(int n, bool withIndex, QStringList& uuids)
+{
+    auto root = std::make_unique<GtObjectGroup>();
+    if (withIndex) root->enableUuidIndex();
+
+    QList<GtObject*> parents{root.get()};
+
+    for (int i = 1; i < n; ++i)
+    {
+        auto* obj = new GtObjectGroup;
+        obj->setObjectName(QStringLiteral("Object_%1").arg(i));
+        parents.at((i - 1) / 10)->appendChild(obj);
+        parents.append(obj);
+        uuids.append(obj->uuid());
+    }
+
+    return root;
+}
+
+} // namespace
+
+static void
+BM_createObjects(benchmark::State& state)
+{
+    createObjects(state, false);
+}
+BENCHMARK(BM_createObjects)->Apply(coldRun);
+
+static void
+BM_createObjects_eagerUuid(benchmark::State& state)
+{
+    createObjects(state, true);
+}
+BENCHMARK(BM_createObjects_eagerUuid)->Apply(coldRun);
+
+static void
+BM_loadObjects(benchmark::State& state)
+{
+    loadObjects(state, false);
+}
+BENCHMARK(BM_loadObjects)->Apply(coldRun);
+
+static void
+BM_loadObjects_stringUuids(benchmark::State& state)
+{
+    loadObjects(state, true);
+}
+BENCHMARK(BM_loadObjects_stringUuids)->Apply(coldRun);
+
+static void
+BM_getObjectByUuid_scan(benchmark::State& state)
+{
+    QStringList uuids;
+    auto root = makeTree(state.range(0), false, uuids);
+
+    int i = 0;
+    for (auto _ : state)
+    {
+        auto const& uuid = uuids.at(i++ % uuids.size());
+        benchmark::DoNotOptimize(root->getObjectByUuid(uuid));
+    }
+}
+BENCHMARK(BM_getObjectByUuid_scan)->RangeMultiplier(10)->Range(100, 100000);
+
+static void
+BM_getObjectByUuid_index(benchmark::State& state)
+{
+    QStringList uuids;
+    auto root = makeTree(state.range(0), true, uuids);
+
+    int i = 0;
+    for (auto _ : state)
+    {
+        auto const& uuid = uuids.at(i++ % uuids.size());
+        benchmark::DoNotOptimize(root->getObjectByUuid(uuid));
+    }
+}
+BENCHMARK(BM_getObjectByUuid_index)->RangeMultiplier(10)->Range(100, 100000);
+
+static void
+BM_buildTree_withIndex(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        QStringList uuids;
+        benchmark::DoNotOptimize(makeTree(state.range(0), true, uuids));
+    }
+}
+BENCHMARK(BM_buildTree_withIndex)->RangeMultiplier(10)->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
+
+static void
+BM_buildTree_withoutIndex(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        QStringList uuids;
+        benchmark::DoNotOptimize(makeTree(state.range(0), false, uuids));
+    }
+}
+BENCHMARK(BM_buildTree_withoutIndex)->RangeMultiplier(10)->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
+
+namespace
+{
+
+/// Changes the property of each object of a deep tree
+void
+propertyChanges(benchmark::State& state, bool subscribe)
+{
+    bench::ProjectSpec spec;
+    spec.nObjects = static_cast<int>(state.range(0));
+    spec.nChildren = 2;
+
+    auto project = bench::makeProject(spec);
+    auto objects = project->findChildren<BenchObject*>();
+
+    // a model observing the project
+    int changes = 0;
+    QMetaObject::Connection connection;
+    GtObjectChangeDispatcher::Subscription subscription;
+
+    if (subscribe)
+    {
+        subscription = GtObjectChangeDispatcher::subscribe(
+            *project, [&changes](GtObject*, GtAbstractProperty*) {
+                ++changes;
+        });
+    }
+    else
+    {
+        connection = QObject::connect(
+            project.get(), qOverload<GtObject*, GtAbstractProperty*>(
+                &GtObject::dataChanged),
+            [&changes](GtObject*, GtAbstractProperty*) { ++changes; });
+    }
+
+    double value = 0.;
+    for (auto _ : state)
+    {
+        value += 1.;
+        for (BenchObject* obj : qAsConst(objects))
+        {
+            obj->change(value);
+        }
+    }
+
+    QObject::disconnect(connection);
+    benchmark::DoNotOptimize(changes);
+
+    state.SetItemsProcessed(state.iterations() * objects.size());
+}
+
+} // namespace
+
+static void
+BM_propertyChanges_signal(benchmark::State& state)
+{
+    propertyChanges(state, false);
+}
+BENCHMARK(BM_propertyChanges_signal)->Apply(objectCounts);
+
+static void
+BM_propertyChanges_dispatcher(benchmark::State& state)
+{
+    propertyChanges(state, true);
+}
+BENCHMARK(BM_propertyChanges_dispatcher)->Apply(objectCounts);
@@ -0,0 +1,122 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bench_objects.h"
+#include "gt_objectmemento.h"
+
+/*
+ * Benchmarks of restoring and merging mementos of wide and deep trees.
+ * All benchmarks take the arguments
+ *   objects:    number of objects
+ *   properties: number of additional double properties per object
+ */
+
+namespace
+{
+
+/// All objects are direct children of the root
+void
+wideTrees(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"objects", "properties"});
+
+    for (int n : {1000, 10000, 50000})
+    {
+        b->Args({n, 4});
+    }
+    b->Args({1000, 256});
+
+    b->Unit(benchmark::kMillisecond);
+}
+
+/// Each object has two children
+void
+deepTrees(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"objects", "properties"});
+
+    for (int n : {1000, 10000, 50000})
+    {
+        b->Args({n, 4});
+    }
+
+    b->Unit(benchmark::kMillisecond);
+}
+
+/// Creates a project with a single package containing the tree
+std::unique_ptr<GtObject>
+makeTree(const benchmark::State& state, int nChildren)
+{
+    bench::ProjectSpec spec;
+    spec.nObjects = static_cast<int>(state.range(0));
+    spec.nProperties = static_cast<int>(state.range(1));
+    spec.nChildren = nChildren > 0 ? nChildren : spec.nObjects;
+
+    return bench::makeProject(spec);
+}
+
+void
+fromMementoToObject(benchmark::State& state, int nChildren)
+{
+    auto project = makeTree(state, nChildren);
+    GtObject& package = *project->childObjects().first();
+    GtObjectMemento const memento = package.toMemento();
+
+    for (auto _ : state)
+    {
+        auto obj = memento.toObject(*gtObjectFactory);
+        benchmark::DoNotOptimize(obj.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void
+fromMementoMerge(benchmark::State& state, int nChildren)
+{
+    auto project = makeTree(state, nChildren);
+    GtObject& package = *project->childObjects().first();
+    GtObjectMemento const memento = package.toMemento();
+
+    for (auto _ : state)
+    {
+        package.fromMemento(memento);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+static void
+BM_fromMemento_toObject_wide(benchmark::State& state)
+{
+    fromMementoToObject(state, 0);
+}
+BENCHMARK(BM_fromMemento_toObject_wide)->Apply(wideTrees);
+
+static void
+BM_fromMemento_merge_wide(benchmark::State& state)
+{
+    fromMementoMerge(state, 0);
+}
+BENCHMARK(BM_fromMemento_merge_wide)->Apply(wideTrees);
+
+static void
+BM_fromMemento_toObject_deep(benchmark::State& state)
+{
+    fromMementoToObject(state, 2);
+}
+BENCHMARK(BM_fromMemento_toObject_deep)->Apply(deepTrees);
+
+static void
+BM_fromMemento_merge_deep(benchmark::State& state)
+{
+    fromMementoMerge(state, 2);
+}
+BENCHMARK(BM_fromMemento_merge_deep)->Apply(deepTrees);
@@ -0,0 +1,83 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bench_objects.h"
+#include "gt_objectmementodiff.h"
+#include "gt_objectmementocache.h"
+
+static void
+BM_makeDiff_singleChange(benchmark::State& state)
+{
+    BenchPackage package;
+    bench::fillObjects(package, state.range(0));
+
+    auto* obj = package.findChildren<BenchObject*>().last();
+    int i = 0;
+
+    for (auto _ : state)
+    {
+        GtObjectMemento before = package.toMemento();
+        obj->setData(++i, 16);
+        GtObjectMemento after = package.toMemento();
+
+        GtObjectMementoDiff diff(before, after);
+        benchmark::DoNotOptimize(diff.isNull());
+    }
+}
+BENCHMARK(BM_makeDiff_singleChange)->RangeMultiplier(10)->Range(1000, 100000)
+    ->Unit(benchmark::kMillisecond);
+
+static void
+BM_makeDiff_singleChange_cached(benchmark::State& state)
+{
+    BenchPackage package;
+    bench::fillObjects(package, state.range(0));
+
+    auto* obj = package.findChildren<BenchObject*>().last();
+    int i = 0;
+
+    GtObjectMementoCache cache;
+    cache.store(package, package.toMemento());
+
+    for (auto _ : state)
+    {
+        GtObjectMemento before = cache.memento(package);
+        obj->setData(++i, 16);
+        GtObjectMemento after = cache.memento(package);
+
+        GtObjectMementoDiff diff(before, after);
+        benchmark::DoNotOptimize(diff.isNull());
+
+        cache.store(package, std::move(after));
+    }
+}
+BENCHMARK(BM_makeDiff_singleChange_cached)->RangeMultiplier(10)
+    ->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+static void
+BM_makeDiff_singleChange_journal(benchmark::State& state)
+{
+    BenchPackage package;
+    bench::fillObjects(package, state.range(0));
+
+    auto* obj = package.findChildren<BenchObject*>().last();
+    int i = 0;
+
+    GtObjectMementoCache cache;
+    cache.commit(package);
+
+    for (auto _ : state)
+    {
+        obj->setData(++i, 16);
+
+        GtObjectMementoDiff diff = cache.commit(package);
+        benchmark::DoNotOptimize(diff.isNull());
+    }
+}
+BENCHMARK(BM_makeDiff_singleChange_journal)->RangeMultiplier(10)
+    ->Range(1000, 100000)->Unit(benchmark::kMillisecond);
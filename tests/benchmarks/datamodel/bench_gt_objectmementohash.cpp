@@ -0,0 +1,59 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bench_objects.h"
+#include "gt_objectmemento.h"
+
+namespace
+{
+
+/// Measures hashing a memento of `state.range(0)` objects with four
+/// properties each
+void
+calculateHashes(benchmark::State& state,
+                GtObjectMemento::HashAlgorithm algorithm)
+{
+    BenchPackage package;
+    bench::fillObjects(package, state.range(0));
+
+    auto const previous = GtObjectMemento::hashAlgorithm();
+    GtObjectMemento::setHashAlgorithm(algorithm);
+
+    for (auto _ : state)
+    {
+        // hashes are cached, thus a new memento is required
+        state.PauseTiming();
+        GtObjectMemento memento = package.toMemento();
+        state.ResumeTiming();
+
+        memento.calculateHashes();
+        benchmark::DoNotOptimize(memento.fullHash().constData());
+    }
+
+    GtObjectMemento::setHashAlgorithm(previous);
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+
+} // namespace
+
+static void
+BM_calculateHashes_sha256(benchmark::State& state)
+{
+    calculateHashes(state, GtObjectMemento::Sha256Hash);
+}
+BENCHMARK(BM_calculateHashes_sha256)->RangeMultiplier(10)->Range(1000, 50000)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void
+BM_calculateHashes_fast(benchmark::State& state)
+{
+    calculateHashes(state, GtObjectMemento::FastHash);
+}
+BENCHMARK(BM_calculateHashes_fast)->RangeMultiplier(10)->Range(1000, 50000)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
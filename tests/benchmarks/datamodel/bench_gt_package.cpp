@@ -0,0 +1,120 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bench_objects.h"
+#include "gt_xmlutilities.h"
+
+#include <QDomDocument>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
+namespace
+{
+
+/// Writes a module file containing `n` objects and returns its path.
+/// Lists reaching `binaryThreshold` entries are stored binary.
+QString
+writeModuleFile(const QTemporaryDir& dir, int n, int listSize = 16,
+                int binaryThreshold = 0)
+{
+    BenchPackage package;
+    bench::fillObjects(package, n, listSize);
+
+    gt::xml::setBinaryListThreshold(binaryThreshold);
+
+    QString filePath = dir.filePath(QStringLiteral("bench_%1.gtmod").arg(n));
+
+    gt::xml::writeStreamDocumentToFile(filePath,
+                                       [&package](QXmlStreamWriter& w) {
+        w.writeStartElement(QStringLiteral("GTLABMODULE"));
+        w.writeAttribute(QStringLiteral("uuid"), package.uuid());
+        bool success = package.saveDataToStream(w);
+        w.writeEndElement();
+        return success;
+    });
+
+    gt::xml::setBinaryListThreshold(0);
+
+    return filePath;
+}
+
+/// Measures reading a module file using a stream reader
+void
+loadPackageStream(benchmark::State& state, const QString& filePath)
+{
+    for (auto _ : state)
+    {
+        QFile file(filePath);
+        file.open(QIODevice::ReadOnly | QIODevice::Text);
+        QXmlStreamReader reader(&file);
+        reader.readNextStartElement();
+
+        BenchPackage package;
+        package.readDataFromStream(reader);
+        benchmark::DoNotOptimize(package.childObjects().size());
+    }
+
+    state.counters["fileSize"] = QFileInfo(filePath).size();
+}
+
+} // namespace
+
+static void
+BM_loadPackage_dom(benchmark::State& state)
+{
+    QTemporaryDir dir;
+    QString filePath = writeModuleFile(dir, state.range(0));
+
+    for (auto _ : state)
+    {
+        QFile file(filePath);
+        QDomDocument document;
+        gt::xml::readDomDocumentFromFile(file, document, true);
+
+        BenchPackage package;
+        package.readData(document.documentElement());
+        benchmark::DoNotOptimize(package.childObjects().size());
+    }
+}
+BENCHMARK(BM_loadPackage_dom)->RangeMultiplier(10)->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
+
+static void
+BM_loadPackage_stream(benchmark::State& state)
+{
+    QTemporaryDir dir;
+    loadPackageStream(state, writeModuleFile(dir, state.range(0)));
+}
+BENCHMARK(BM_loadPackage_stream)->RangeMultiplier(10)->Range(100, 100000)
+    ->Unit(benchmark::kMillisecond);
+
+/// Number of values of the double lists of the large list benchmarks
+constexpr int largeListSize = 1000;
+
+static void
+BM_loadPackage_largeLists_text(benchmark::State& state)
+{
+    QTemporaryDir dir;
+    loadPackageStream(state, writeModuleFile(dir, state.range(0),
+                                             largeListSize));
+}
+BENCHMARK(BM_loadPackage_largeLists_text)->RangeMultiplier(10)
+    ->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+static void
+BM_loadPackage_largeLists_binary(benchmark::State& state)
+{
+    QTemporaryDir dir;
+    loadPackageStream(state, writeModuleFile(dir, state.range(0),
+                                             largeListSize, largeListSize));
+}
+BENCHMARK(BM_loadPackage_largeLists_binary)->RangeMultiplier(10)
+    ->Range(10, 1000)->Unit(benchmark::kMillisecond);
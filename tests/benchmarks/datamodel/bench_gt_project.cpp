@@ -0,0 +1,385 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "bench_objects.h"
+#include "gt_objectmemento.h"
+#include "gt_objectmementodiff.h"
+#include "gt_xmlutilities.h"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
+/*
+ * Benchmarks of the core datamodel operations on synthetic projects.
+ * All benchmarks take the arguments
+ *   objects:    number of objects per package
+ *   properties: number of additional double properties per object
+ *   listSize:   number of values of the list property of each object
+ *
+ * Use --benchmark_out=<file> --benchmark_out_format=json to store the
+ * results and compare.py of Google Benchmark to compare two runs.
+ */
+
+namespace
+{
+
+/// Number of packages of the project save and load benchmarks
+constexpr int nPackages = 4;
+
+bench::ProjectSpec
+projectSpec(const benchmark::State& state, int packages = 1)
+{
+    bench::ProjectSpec spec;
+    spec.nObjects = static_cast<int>(state.range(0));
+    spec.nProperties = static_cast<int>(state.range(1));
+    spec.listSize = static_cast<int>(state.range(2));
+    spec.nPackages = packages;
+
+    return spec;
+}
+
+void
+projectSizes(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"objects", "properties", "listSize"});
+
+    for (int n : {1000, 10000, 100000})
+    {
+        b->Args({n, 4, 16});
+    }
+
+    // many properties and large lists
+    b->Args({10000, 32, 16});
+    b->Args({10000, 4, 1000});
+
+    b->Unit(benchmark::kMillisecond);
+}
+
+/// Returns the first package of the project
+GtObject&
+package(GtObject& project)
+{
+    return *project.childObjects().first();
+}
+
+/// Writes the package into a module file
+bool
+writeModuleFile(GtObject& package, const QString& filePath)
+{
+    auto& p = static_cast<BenchPackage&>(package);
+
+    return gt::xml::writeStreamDocumentToFile(filePath,
+                                              [&p](QXmlStreamWriter& w) {
+        w.writeStartElement(QStringLiteral("GTLABMODULE"));
+        w.writeAttribute(QStringLiteral("uuid"), p.uuid());
+        bool success = p.saveDataToStream(w);
+        w.writeEndElement();
+        return success;
+    });
+}
+
+/// Reads a package from a module file
+std::unique_ptr<BenchPackage>
+readModuleFile(const QString& filePath)
+{
+    QFile file(filePath);
+    file.open(QIODevice::ReadOnly | QIODevice::Text);
+
+    QXmlStreamReader reader(&file);
+    reader.readNextStartElement();
+
+    auto package = std::make_unique<BenchPackage>();
+    package->readDataFromStream(reader);
+
+    return package;
+}
+
+} // namespace
+
+static void
+BM_toMemento(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+
+    for (auto _ : state)
+    {
+        GtObjectMemento memento = package(*project).toMemento();
+        benchmark::DoNotOptimize(memento.isNull());
+    }
+}
+BENCHMARK(BM_toMemento)->Apply(projectSizes);
+
+static void
+BM_fromMemento_toObject(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+    GtObjectMemento const memento = package(*project).toMemento();
+
+    for (auto _ : state)
+    {
+        auto obj = memento.toObject(*gtObjectFactory);
+        benchmark::DoNotOptimize(obj.get());
+    }
+}
+BENCHMARK(BM_fromMemento_toObject)->Apply(projectSizes);
+
+static void
+BM_fromMemento_merge(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+    GtObject& target = package(*project);
+    GtObjectMemento const memento = target.toMemento();
+
+    for (auto _ : state)
+    {
+        target.fromMemento(memento);
+    }
+}
+BENCHMARK(BM_fromMemento_merge)->Apply(projectSizes);
+
+static void
+BM_domRoundTrip(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+    GtObjectMemento const memento = package(*project).toMemento();
+
+    for (auto _ : state)
+    {
+        QByteArray const data = memento.toByteArray();
+
+        GtObjectMemento restored(data);
+        benchmark::DoNotOptimize(restored.isNull());
+
+        state.counters["bytes"] = data.size();
+    }
+}
+BENCHMARK(BM_domRoundTrip)->Apply(projectSizes);
+
+static void
+BM_xmlStreamRoundTrip(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+
+    QTemporaryDir dir;
+    QString const filePath = dir.filePath(QStringLiteral("bench.gtmod"));
+
+    for (auto _ : state)
+    {
+        writeModuleFile(package(*project), filePath);
+
+        auto restored = readModuleFile(filePath);
+        benchmark::DoNotOptimize(restored->childObjects().size());
+    }
+}
+BENCHMARK(BM_xmlStreamRoundTrip)->Apply(projectSizes);
+
+static void
+BM_makeDiff(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+    GtObject& target = package(*project);
+
+    GtObjectMemento const before = target.toMemento();
+
+    // change every 100th object
+    auto objects = target.findChildren<BenchObject*>();
+    for (int i = 0; i < objects.size(); i += 100)
+    {
+        objects[i]->change(-i);
+    }
+
+    GtObjectMemento const after = target.toMemento();
+
+    for (auto _ : state)
+    {
+        GtObjectMementoDiff diff(before, after);
+        benchmark::DoNotOptimize(diff.isNull());
+    }
+}
+BENCHMARK(BM_makeDiff)->Apply(projectSizes);
+
+static void
+BM_applyDiff(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+    GtObject& target = package(*project);
+
+    GtObjectMemento const before = target.toMemento();
+
+    auto objects = target.findChildren<BenchObject*>();
+    for (int i = 0; i < objects.size(); i += 100)
+    {
+        objects[i]->change(-i);
+    }
+
+    GtObjectMementoDiff diff(before, target.toMemento());
+    target.revertDiff(diff);
+
+    for (auto _ : state)
+    {
+        // apply and revert to keep the state of the target
+        bool success = target.applyDiff(diff) && target.revertDiff(diff);
+        if (!success)
+        {
+            state.SkipWithError("Failed to apply diff");
+            break;
+        }
+    }
+}
+BENCHMARK(BM_applyDiff)->Apply(projectSizes);
+
+static void
+BM_calculateHashes(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+
+    for (auto _ : state)
+    {
+        // hashes are cached, thus a new memento is required
+        state.PauseTiming();
+        GtObjectMemento memento = package(*project).toMemento();
+        state.ResumeTiming();
+
+        memento.calculateHashes();
+        benchmark::DoNotOptimize(memento.fullHash().constData());
+    }
+}
+BENCHMARK(BM_calculateHashes)->Apply(projectSizes);
+
+static void
+BM_getObjectByUuid(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+    project->enableUuidIndex();
+
+    auto objects = project->findChildren<BenchObject*>();
+    QStringList uuids;
+    for (int i = 0; i < objects.size(); i += objects.size() / 100 + 1)
+    {
+        uuids.append(objects[i]->uuid());
+    }
+
+    for (auto _ : state)
+    {
+        for (const QString& uuid : qAsConst(uuids))
+        {
+            benchmark::DoNotOptimize(project->getObjectByUuid(uuid));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * uuids.size());
+}
+BENCHMARK(BM_getObjectByUuid)->Apply(projectSizes);
+
+static void
+BM_getObjectByPath(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+
+    auto objects = project->findChildren<BenchObject*>();
+    QStringList paths;
+    for (int i = 0; i < objects.size(); i += objects.size() / 100 + 1)
+    {
+        paths.append(objects[i]->objectPath());
+    }
+
+    for (auto _ : state)
+    {
+        for (const QString& path : qAsConst(paths))
+        {
+            benchmark::DoNotOptimize(project->getObjectByPath(path));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * paths.size());
+}
+BENCHMARK(BM_getObjectByPath)->Apply(projectSizes);
+
+static void
+BM_findChildren(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+
+    for (auto _ : state)
+    {
+        auto packages = project->findChildren<BenchPackage*>();
+        benchmark::DoNotOptimize(packages.size());
+    }
+}
+BENCHMARK(BM_findChildren)->Apply(projectSizes);
+
+static void
+BM_findDescendants(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state));
+    project->enableClassIndex();
+
+    for (auto _ : state)
+    {
+        auto packages = project->findDescendants<BenchPackage*>();
+        benchmark::DoNotOptimize(packages.size());
+    }
+}
+BENCHMARK(BM_findDescendants)->Apply(projectSizes);
+
+static void
+BM_projectSave(benchmark::State& state)
+{
+    auto project = bench::makeProject(projectSpec(state, nPackages));
+
+    QTemporaryDir dir;
+
+    for (auto _ : state)
+    {
+        for (GtObject* obj : project->childObjects())
+        {
+            QString filePath = dir.filePath(obj->objectName() +
+                                            QStringLiteral(".gtmod"));
+            if (!writeModuleFile(*obj, filePath))
+            {
+                state.SkipWithError("Failed to write module file");
+                return;
+            }
+        }
+    }
+}
+BENCHMARK(BM_projectSave)->Apply(projectSizes);
+
+static void
+BM_projectLoad(benchmark::State& state)
+{
+    QTemporaryDir dir;
+    QStringList files;
+
+    {
+        auto project = bench::makeProject(projectSpec(state, nPackages));
+
+        for (GtObject* obj : project->childObjects())
+        {
+            files.append(dir.filePath(obj->objectName() +
+                                      QStringLiteral(".gtmod")));
+            writeModuleFile(*obj, files.last());
+        }
+    }
+
+    for (auto _ : state)
+    {
+        GtObjectGroup project;
+
+        for (const QString& filePath : qAsConst(files))
+        {
+            project.appendChild(readModuleFile(filePath).release());
+        }
+
+        benchmark::DoNotOptimize(project.childObjects().size());
+    }
+}
+BENCHMARK(BM_projectLoad)->Apply(projectSizes);
@@ -0,0 +1,178 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#ifndef BENCH_OBJECTS_H
+#define BENCH_OBJECTS_H
+
+#include "gt_objectgroup.h"
+#include "gt_package.h"
+#include "gt_objectfactory.h"
+#include "gt_doubleproperty.h"
+#include "gt_intproperty.h"
+#include "gt_stringproperty.h"
+#include "gt_doublelistproperty.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Object with a typical set of properties used by the benchmarks
+ */
+class BenchObject : public GtObjectGroup
+{
+    Q_OBJECT
+
+public:
+    Q_INVOKABLE BenchObject() :
+        m_double("double", "Double", "Double", GtUnit::Category::None),
+        m_int("int", "Int", "Int", 0),
+        m_string("string", "String", "String"),
+        m_list("list", "List")
+    {
+        registerProperty(m_double);
+        registerProperty(m_int);
+        registerProperty(m_string);
+        registerProperty(m_list);
+
+        for (int i = 0; i < nExtraProperties(); ++i)
+        {
+            auto id = QStringLiteral("extra_%1").arg(i);
+            m_extra.push_back(std::make_unique<GtDoubleProperty>(id, id));
+            registerProperty(*m_extra.back());
+        }
+    }
+
+    /// Number of additional double properties of new objects. Objects
+    /// created by the factory while restoring get the same properties.
+    static int& nExtraProperties()
+    {
+        static int n = 0;
+        return n;
+    }
+
+    /// Fills the properties with data derived from `i`
+    void setData(int i, int listSize)
+    {
+        m_double = i * 0.123;
+        m_int = i;
+        m_string = QStringLiteral("Value %1").arg(i);
+
+        QVector<double> values(listSize);
+        for (int j = 0; j < listSize; ++j) values[j] = i + j * 1e-3;
+        m_list.setVal(values);
+
+        for (size_t j = 0; j < m_extra.size(); ++j)
+        {
+            m_extra[j]->setVal(i + j * 0.5);
+        }
+    }
+
+    /// Changes the value of the double property
+    void change(double value) { m_double = value; }
+
+private:
+    GtDoubleProperty m_double;
+    GtIntProperty m_int;
+    GtStringProperty m_string;
+    GtDoubleListProperty m_list;
+    std::vector<std::unique_ptr<GtDoubleProperty>> m_extra;
+};
+
+/**
+ * @brief Package without custom data format used by the benchmarks
+ */
+class BenchPackage : public GtPackage
+{
+    Q_OBJECT
+    Q_CLASSINFO("threadSafe", "true")
+
+public:
+    Q_INVOKABLE BenchPackage() = default;
+
+    bool usesDefaultDataFormat() const override { return true; }
+};
+
+namespace bench
+{
+
+/**
+ * @brief Layout of a synthetic project
+ */
+struct ProjectSpec
+{
+    /// Number of objects per package
+    int nObjects = 1000;
+    /// Number of additional double properties per object
+    int nProperties = 0;
+    /// Number of values of the list property of each object
+    int listSize = 16;
+    /// Maximum number of children per object
+    int nChildren = 10;
+    /// Number of packages
+    int nPackages = 1;
+};
+
+/**
+ * @brief Appends the objects of a package specified by `spec` to the parent
+ */
+inline void
+fillObjects(GtObject& parent, const ProjectSpec& spec)
+{
+    gtObjectFactory->registerClass(BenchObject::staticMetaObject);
+    BenchObject::nExtraProperties() = spec.nProperties;
+
+    QList<GtObject*> parents{&parent};
+
+    for (int i = 1; i <= spec.nObjects; ++i)
+    {
+        auto* obj = new BenchObject;
+        obj->setObjectName(QStringLiteral("Object_%1").arg(i));
+        obj->setData(i, spec.listSize);
+        parents.at((i - 1) / spec.nChildren)->appendChild(obj);
+        parents.append(obj);
+    }
+}
+
+/**
+ * @brief Appends `n` objects to the parent, each object has up to 10
+ * children and `listSize` values in its list property.
+ */
+inline void
+fillObjects(GtObject& parent, int n, int listSize = 16)
+{
+    ProjectSpec spec;
+    spec.nObjects = n;
+    spec.listSize = listSize;
+
+    fillObjects(parent, spec);
+}
+
+/**
+ * @brief Creates a synthetic project. The returned root object contains
+ * `spec.nPackages` packages.
+ */
+inline std::unique_ptr<GtObject>
+makeProject(const ProjectSpec& spec)
+{
+    gtObjectFactory->registerClass(BenchPackage::staticMetaObject);
+
+    auto root = std::make_unique<GtObjectGroup>();
+    root->setObjectName(QStringLiteral("Project"));
+
+    for (int i = 0; i < spec.nPackages; ++i)
+    {
+        auto* package = new BenchPackage;
+        package->setObjectName(QStringLiteral("Package_%1").arg(i));
+        fillObjects(*package, spec);
+        root->appendChild(package);
+    }
+
+    return root;
+}
+
+} // namespace bench
+
+#endif // BENCH_OBJECTS_H
@@ -0,0 +1,40 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <QCoreApplication>
+
+#include "gt_version.h"
+#include "bench_revision.h"
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+
+    ::benchmark::Initialize(&argc, argv);
+
+    // allows to compare results of different revisions
+    // (--benchmark_out_format=json)
+    ::benchmark::AddCustomContext("gtlab_version",
+                                  QStringLiteral("%1.%2.%3")
+                                      .arg(GT_VERSION_MAJOR)
+                                      .arg(GT_VERSION_MINOR)
+                                      .arg(GT_VERSION_PATCH)
+                                      .toStdString());
+    ::benchmark::AddCustomContext("gtlab_revision", GT_BENCHMARK_REVISION);
+    ::benchmark::AddCustomContext("qt_version", qVersion());
+
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_abstractrunnable.h"
+#include "gt_objectfactory.h"
+#include "gt_objectgroup.h"
+
+#include <QDir>
+
+namespace
+{
+
+/// Runnable restoring the transferred data like GtRunnable
+class TestRunnable : public GtAbstractRunnable
+{
+public:
+    void run() override {}
+
+    QDir tempDir() override { return {}; }
+
+    bool clearTempDir(const QString&) override { return true; }
+
+    QString projectPath() override { return {}; }
+
+    void readObjects()
+    {
+        for (GtObjectMemento& memento : m_inputData)
+        {
+            GtObject* obj = memento.restore(gtObjectFactory);
+            obj->enableUuidIndex();
+            m_linkedObjects.append(obj);
+        }
+
+        initPartialObjects();
+    }
+
+    QList<GtObject*> output() const { return outputObjects(); }
+};
+
+QStringList
+names(const QList<GtObject*>& objects)
+{
+    QStringList retval;
+
+    for (const GtObject* obj : objects)
+    {
+        retval.append(obj->objectName());
+    }
+
+    return retval;
+}
+
+} // namespace
+
+/// This is a test fixture that does a init for each test
+class TestGtAbstractRunnable : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        gtObjectFactory->registerClass(GtObjectGroup::staticMetaObject);
+
+        package = new GtObjectGroup(&source);
+        package->setObjectName("Package");
+
+        parent = new GtObjectGroup(package);
+        parent->setObjectName("Parent");
+
+        linked = new GtObjectGroup(parent);
+        linked->setObjectName("Linked");
+
+        sibling = new GtObjectGroup(parent);
+        sibling->setObjectName("Sibling");
+
+        // the linked object is transferred with its parents like the task
+        // runner does
+        GtObjectMemento parentMemento = GtObjectMemento::propertiesOnly(*parent);
+        parentMemento.childObjects.push_back(linked->toMemento());
+
+        GtObjectMemento packageMemento =
+            GtObjectMemento::propertiesOnly(*package);
+        packageMemento.childObjects.push_back(parentMemento);
+
+        runnable.appendSourceData(packageMemento);
+        runnable.setPartialObjects({package->uuid(), parent->uuid()});
+
+        runnable.setSourceDataProvider([this](const QString& uuid,
+                                              const GtObjectPath& path) {
+            GtObject* obj = uuid.isEmpty() ? path.getObject(package) :
+                                             source.getObjectByUuid(uuid);
+
+            QList<GtObjectMemento> mementos;
+
+            if (!obj)
+            {
+                return mementos;
+            }
+
+            ++fetches;
+            mementos.append(obj->toMemento());
+
+            for (GtObject* p = obj->parentObject(); p != &source;
+                 p = p->parentObject())
+            {
+                mementos.prepend(GtObjectMemento::propertiesOnly(*p));
+            }
+
+            return mementos;
+        });
+
+        runnable.readObjects();
+    }
+
+    GtObjectGroup source;
+    GtObjectGroup* package{};
+    GtObjectGroup* parent{};
+    GtObjectGroup* linked{};
+    GtObjectGroup* sibling{};
+
+    TestRunnable runnable;
+    int fetches{0};
+};
+
+TEST_F(TestGtAbstractRunnable, linkedDataOnly)
+{
+    auto* obj = runnable.data<GtObject*>(linked->uuid());
+    ASSERT_TRUE(obj != nullptr);
+    EXPECT_EQ(obj->objectName(), "Linked");
+    EXPECT_EQ(fetches, 0);
+
+    // unchanged parents are not written back
+    EXPECT_EQ(names(runnable.output()), QStringList{"Linked"});
+}
+
+TEST_F(TestGtAbstractRunnable, readSibling)
+{
+    auto* obj = runnable.data<GtObject*>(sibling->uuid());
+    ASSERT_TRUE(obj != nullptr);
+    EXPECT_EQ(fetches, 1);
+
+    // the sibling is added to the transferred parent
+    ASSERT_TRUE(obj->parentObject() != nullptr);
+    EXPECT_EQ(obj->parentObject()->objectName(), "Parent");
+    EXPECT_EQ(runnable.data<GtObject*>(linked->uuid())->parentObject(),
+              obj->parentObject());
+
+    // fetched data is kept
+    EXPECT_EQ(runnable.data<GtObject*>(sibling->uuid()), obj);
+    EXPECT_EQ(runnable.data<GtObject*>(GtObjectPath("Package;Parent;Sibling")),
+              obj);
+    EXPECT_EQ(fetches, 1);
+
+    EXPECT_EQ(names(runnable.output()), (QStringList{"Linked", "Sibling"}));
+}
+
+TEST_F(TestGtAbstractRunnable, readSiblingByPath)
+{
+    auto* obj =
+        runnable.data<GtObject*>(GtObjectPath("Package;Parent;Sibling"));
+    ASSERT_TRUE(obj != nullptr);
+    EXPECT_EQ(obj->uuid(), sibling->uuid());
+    EXPECT_EQ(fetches, 1);
+}
+
+TEST_F(TestGtAbstractRunnable, accessPartialParent)
+{
+    auto* linkedCopy = runnable.data<GtObject*>(linked->uuid());
+    linkedCopy->setObjectName("Changed");
+
+    // the parent is completed instead of returning the partial parent
+    auto* parentCopy = runnable.data<GtObject*>(parent->uuid());
+    ASSERT_TRUE(parentCopy != nullptr);
+    EXPECT_EQ(names(parentCopy->findDirectChildren()),
+              (QStringList{"Changed", "Sibling"}));
+
+    // the transferred child is kept
+    EXPECT_EQ(parentCopy->findDirectChildren().first(), linkedCopy);
+
+    EXPECT_EQ(names(runnable.output()), QStringList{"Parent"});
+}
+
+TEST_F(TestGtAbstractRunnable, createChild)
+{
+    auto* linkedCopy = runnable.data<GtObject*>(linked->uuid());
+
+    // the parent is modified without accessing it
+    auto* child = new GtObjectGroup;
+    child->setObjectName("New");
+    linkedCopy->parentObject()->appendChild(child);
+    EXPECT_EQ(fetches, 0);
+
+    // the modified parent is written back completely
+    QList<GtObject*> output = runnable.output();
+    ASSERT_EQ(names(output), QStringList{"Parent"});
+    EXPECT_EQ(names(output.first()->findDirectChildren()),
+              (QStringList{"Linked", "Sibling", "New"}));
+}
+
+TEST_F(TestGtAbstractRunnable, deleteChild)
+{
+    auto* linkedCopy = runnable.data<GtObject*>(linked->uuid());
+    GtObject* parentCopy = linkedCopy->parentObject();
+    delete linkedCopy;
+
+    // the deleted child is not restored
+    QList<GtObject*> output = runnable.output();
+    ASSERT_EQ(output, QList<GtObject*>{parentCopy});
+    EXPECT_EQ(names(parentCopy->findDirectChildren()),
+              QStringList{"Sibling"});
+}
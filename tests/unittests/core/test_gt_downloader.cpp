@@ -0,0 +1,421 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_downloader.h"
+
+#include <QCryptographicHash>
+#include <QEventLoop>
+#include <QFile>
+#include <QMap>
+#include <QPointer>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTemporaryDir>
+#include <QTimer>
+
+#include <algorithm>
+#include <memory>
+
+namespace
+{
+
+QByteArray
+testData(int size, char seed)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    for (int i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<char>(i * 31 + seed);
+    }
+    return data;
+}
+
+QByteArray
+sha256(const QByteArray& data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha256).toHex();
+}
+
+QByteArray
+readFile(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return {};
+    return file.readAll();
+}
+
+/// Minimal HTTP server serving files from memory
+class TestHttpServer
+{
+public:
+
+    TestHttpServer()
+    {
+        server.listen(QHostAddress::LocalHost);
+
+        QObject::connect(&server, &QTcpServer::newConnection, [this]() {
+            while (QTcpSocket* socket = server.nextPendingConnection())
+            {
+                accept(socket);
+            }
+        });
+    }
+
+    QUrl url(const QString& fileName) const
+    {
+        return QUrl(QStringLiteral("http://127.0.0.1:%1/%2")
+                    .arg(server.serverPort()).arg(fileName));
+    }
+
+    /// files served by their name
+    QMap<QByteArray, QByteArray> files;
+
+    /// whether range requests are supported
+    bool supportsRanges{true};
+
+    /// whether entity tags are sent
+    bool sendsEntityTags{true};
+
+    /// number of body bytes sent before the connection is dropped (-1: all)
+    int dropAfter{-1};
+
+    /// delay of the responses in ms
+    int delay{0};
+
+    /// offsets of the requests (0 if no range was requested)
+    QList<qint64> offsets;
+
+    /// maximum number of requests processed at the same time
+    int maxActive{0};
+
+private:
+
+    QTcpServer server;
+
+    int active{0};
+
+    void accept(QTcpSocket* socket)
+    {
+        auto buffer = std::make_shared<QByteArray>();
+
+        QObject::connect(socket, &QTcpSocket::readyRead, socket,
+                         [this, socket, buffer]() {
+            buffer->append(socket->readAll());
+
+            int end = buffer->indexOf("\r\n\r\n");
+            if (end < 0) return;
+
+            QByteArray request = buffer->left(end);
+            buffer->remove(0, end + 4);
+
+            ++active;
+            maxActive = std::max(maxActive, active);
+
+            QPointer<QTcpSocket> s(socket);
+            QTimer::singleShot(delay, socket, [this, s, request]() {
+                --active;
+                if (s) respond(*s, request);
+            });
+        });
+        QObject::connect(socket, &QTcpSocket::disconnected,
+                         socket, &QObject::deleteLater);
+    }
+
+    void respond(QTcpSocket& socket, const QByteArray& request)
+    {
+        QList<QByteArray> lines = request.split('\n');
+        QByteArray path = lines.first().split(' ').value(1).mid(1);
+
+        qint64 offset = 0;
+        QByteArray ifRange;
+        for (const QByteArray& line : qAsConst(lines))
+        {
+            if (line.toLower().startsWith("range: bytes="))
+            {
+                offset = line.mid(13).split('-').first().trimmed().toLongLong();
+            }
+            else if (line.toLower().startsWith("if-range:"))
+            {
+                ifRange = line.mid(9).trimmed();
+            }
+        }
+        offsets.append(offset);
+
+        if (!files.contains(path))
+        {
+            socket.write("HTTP/1.1 404 Not Found\r\n"
+                         "Content-Length: 0\r\n\r\n");
+            return;
+        }
+
+        QByteArray const& data = files[path];
+        QByteArray const etag = '"' + sha256(data) + '"';
+        QByteArray header;
+        QByteArray body;
+
+        // the whole file is sent if it changed
+        if (!ifRange.isEmpty() && ifRange != etag)
+        {
+            offset = 0;
+        }
+
+        if (offset > 0 && supportsRanges)
+        {
+            if (offset >= data.size())
+            {
+                socket.write("HTTP/1.1 416 Range Not Satisfiable\r\n"
+                             "Content-Length: 0\r\n\r\n");
+                return;
+            }
+
+            body = data.mid(offset);
+            header = "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " +
+                     QByteArray::number(offset) + "-" +
+                     QByteArray::number(data.size() - 1) + "/" +
+                     QByteArray::number(data.size()) + "\r\n";
+        }
+        else
+        {
+            body = data;
+            header = "HTTP/1.1 200 OK\r\n";
+        }
+
+        if (sendsEntityTags)
+        {
+            header += "ETag: " + etag + "\r\n";
+        }
+
+        header += "Content-Length: " + QByteArray::number(body.size()) +
+                  "\r\n\r\n";
+
+        socket.write(header);
+
+        if (dropAfter >= 0)
+        {
+            socket.write(body.left(dropAfter));
+            socket.disconnectFromHost();
+            return;
+        }
+
+        socket.write(body);
+    }
+};
+
+} // namespace
+
+class TestGtDownloader : public testing::Test
+{
+protected:
+
+    /// Runs the downloader and returns whether it finished
+    bool run(GtDownloader& downloader)
+    {
+        bool finished = false;
+
+        QEventLoop loop;
+        QObject::connect(&downloader, &GtDownloader::finished, &loop,
+                         [&]() { finished = true; loop.quit(); });
+        QTimer::singleShot(10000, &loop, &QEventLoop::quit);
+
+        downloader.exec();
+        if (!finished) loop.exec();
+
+        return finished;
+    }
+
+    TestHttpServer server;
+
+    QTemporaryDir dir;
+};
+
+TEST_F(TestGtDownloader, parallelDownloads)
+{
+    server.delay = 50;
+
+    GtDownloader downloader;
+    downloader.setMaxParallelDownloads(3);
+    EXPECT_EQ(downloader.maxParallelDownloads(), 3);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        QString fileName = QStringLiteral("file%1.bin").arg(i);
+        server.files.insert(fileName.toLatin1(),
+                            testData(100000 + i, static_cast<char>(i)));
+        downloader.addFileDownload(server.url(fileName), dir.path(),
+                                   fileName);
+    }
+
+    ASSERT_TRUE(run(downloader));
+
+    EXPECT_GT(server.maxActive, 1);
+    EXPECT_LE(server.maxActive, 3);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        QString fileName = QStringLiteral("file%1.bin").arg(i);
+        EXPECT_EQ(readFile(dir.filePath(fileName)),
+                  server.files[fileName.toLatin1()]);
+        EXPECT_FALSE(QFile::exists(dir.filePath(fileName + ".part")));
+    }
+}
+
+TEST_F(TestGtDownloader, resumeInterruptedDownload)
+{
+    QByteArray const data = testData(200000, 1);
+    server.files.insert("data.bin", data);
+
+    // connection is dropped after half of the file
+    server.dropAfter = data.size() / 2;
+
+    GtDownloader downloader;
+    downloader.addFileDownload(server.url("data.bin"), dir.path(),
+                               "data.bin", sha256(data));
+    ASSERT_TRUE(run(downloader));
+
+    EXPECT_FALSE(QFile::exists(dir.filePath("data.bin")));
+    qint64 partSize = QFile(dir.filePath("data.bin.part")).size();
+    EXPECT_GT(partSize, 0);
+    EXPECT_LE(partSize, data.size() / 2);
+
+    // download is resumed
+    server.dropAfter = -1;
+
+    GtDownloader resumed;
+    resumed.addFileDownload(server.url("data.bin"), dir.path(),
+                            "data.bin", sha256(data));
+    ASSERT_TRUE(run(resumed));
+
+    EXPECT_EQ(server.offsets.last(), partSize);
+    EXPECT_EQ(readFile(dir.filePath("data.bin")), data);
+    EXPECT_FALSE(QFile::exists(dir.filePath("data.bin.part")));
+}
+
+TEST_F(TestGtDownloader, resumeChangedFile)
+{
+    QByteArray const data = testData(200000, 6);
+    server.files.insert("data.bin", data);
+    server.dropAfter = data.size() / 2;
+
+    GtDownloader downloader;
+    downloader.addFileDownload(server.url("data.bin"), dir.path(),
+                               "data.bin");
+    ASSERT_TRUE(run(downloader));
+
+    qint64 partSize = QFile(dir.filePath("data.bin.part")).size();
+    EXPECT_GT(partSize, 0);
+    EXPECT_TRUE(QFile::exists(dir.filePath("data.bin.part.validator")));
+
+    // the remote file changes before the download is resumed
+    QByteArray const changed = testData(200000, 7);
+    server.files.insert("data.bin", changed);
+    server.dropAfter = -1;
+
+    GtDownloader resumed;
+    resumed.addFileDownload(server.url("data.bin"), dir.path(),
+                            "data.bin");
+    ASSERT_TRUE(run(resumed));
+
+    // the range is requested, but the whole file is sent
+    EXPECT_EQ(server.offsets.last(), partSize);
+    EXPECT_EQ(readFile(dir.filePath("data.bin")), changed);
+    EXPECT_FALSE(QFile::exists(dir.filePath("data.bin.part")));
+    EXPECT_FALSE(QFile::exists(dir.filePath("data.bin.part.validator")));
+}
+
+TEST_F(TestGtDownloader, restartWithoutValidator)
+{
+    QByteArray const data = testData(200000, 8);
+    server.files.insert("data.bin", data);
+    server.sendsEntityTags = false;
+    server.dropAfter = data.size() / 2;
+
+    GtDownloader downloader;
+    downloader.addFileDownload(server.url("data.bin"), dir.path(),
+                               "data.bin");
+    ASSERT_TRUE(run(downloader));
+
+    EXPECT_GT(QFile(dir.filePath("data.bin.part")).size(), 0);
+
+    QByteArray const changed = testData(200000, 9);
+    server.files.insert("data.bin", changed);
+    server.dropAfter = -1;
+
+    // the change cannot be detected, thus the download is started over
+    GtDownloader restarted;
+    restarted.addFileDownload(server.url("data.bin"), dir.path(),
+                              "data.bin");
+    ASSERT_TRUE(run(restarted));
+
+    EXPECT_EQ(server.offsets.last(), 0);
+    EXPECT_EQ(readFile(dir.filePath("data.bin")), changed);
+}
+
+TEST_F(TestGtDownloader, rangesNotSupported)
+{
+    QByteArray const data = testData(1000, 2);
+    server.files.insert("data.bin", data);
+    server.supportsRanges = false;
+
+    QFile part(dir.filePath("data.bin.part"));
+    ASSERT_TRUE(part.open(QIODevice::WriteOnly));
+    part.write("garbage");
+    part.close();
+
+    GtDownloader downloader;
+    downloader.addFileDownload(server.url("data.bin"), dir.path(),
+                               "data.bin", sha256(data));
+    ASSERT_TRUE(run(downloader));
+
+    EXPECT_EQ(server.offsets, QList<qint64>{7});
+    EXPECT_EQ(readFile(dir.filePath("data.bin")), data);
+}
+
+TEST_F(TestGtDownloader, invalidPartialFile)
+{
+    QByteArray const data = testData(1000, 3);
+    server.files.insert("data.bin", data);
+
+    // partial file is larger than the file
+    QFile part(dir.filePath("data.bin.part"));
+    ASSERT_TRUE(part.open(QIODevice::WriteOnly));
+    part.write(testData(2000, 4));
+    part.close();
+
+    // the partial file is resumed as its checksum is known
+    GtDownloader downloader;
+    downloader.addFileDownload(server.url("data.bin"), dir.path(),
+                               "data.bin", sha256(data));
+    ASSERT_TRUE(run(downloader));
+
+    EXPECT_EQ(server.offsets, (QList<qint64>{2000, 0}));
+    EXPECT_EQ(readFile(dir.filePath("data.bin")), data);
+}
+
+TEST_F(TestGtDownloader, checksumMismatch)
+{
+    server.files.insert("data.bin", testData(1000, 5));
+
+    GtDownloader downloader;
+    downloader.addFileDownload(server.url("data.bin"), dir.path(),
+                               "data.bin", sha256("other data"));
+    ASSERT_TRUE(run(downloader));
+
+    EXPECT_FALSE(QFile::exists(dir.filePath("data.bin")));
+    EXPECT_FALSE(QFile::exists(dir.filePath("data.bin.part")));
+}
+
+TEST_F(TestGtDownloader, fileNotFound)
+{
+    GtDownloader downloader;
+    downloader.addFileDownload(server.url("missing.bin"), dir.path(),
+                               "missing.bin");
+    ASSERT_TRUE(run(downloader));
+
+    EXPECT_FALSE(QFile::exists(dir.filePath("missing.bin")));
+    EXPECT_FALSE(QFile::exists(dir.filePath("missing.bin.part")));
+}
@@ -0,0 +1,88 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "internal/gt_modulesavestate.h"
+#include "gt_objectgroup.h"
+
+/// This is a test fixture that does a init for each test
+class TestGtModuleSaveState : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        package.setObjectName("Package");
+
+        child = new GtObjectGroup;
+        child->setObjectName("Child");
+        package.appendChild(child);
+    }
+
+    GtModuleSaveState state;
+    GtObjectGroup package;
+    GtObjectGroup* child{};
+};
+
+TEST_F(TestGtModuleSaveState, saveModifySave)
+{
+    EXPECT_TRUE(state.needsSaving("mod", package));
+
+    // first save
+    state.setSaved("mod", "file1", package);
+    EXPECT_EQ(state.fileHash("mod"), "file1");
+    EXPECT_FALSE(state.needsSaving("mod", package));
+
+    child->setObjectName("Renamed");
+    EXPECT_TRUE(state.needsSaving("mod", package));
+
+    // second save
+    state.setSaved("mod", "file2", package);
+    EXPECT_EQ(state.fileHash("mod"), "file2");
+    EXPECT_FALSE(state.needsSaving("mod", package));
+}
+
+TEST_F(TestGtModuleSaveState, loadModifySave)
+{
+    // hash of the project file, the package is not read yet
+    state.setFileHash("mod", "file1");
+    EXPECT_TRUE(state.needsSaving("mod", package));
+
+    // package read from the file
+    state.setSaved("mod", state.fileHash("mod"), package);
+    EXPECT_FALSE(state.needsSaving("mod", package));
+
+    new GtObjectGroup(child);
+    EXPECT_TRUE(state.needsSaving("mod", package));
+}
+
+TEST_F(TestGtModuleSaveState, changeFlagsAreIgnored)
+{
+    state.setSaved("mod", "file1", package);
+
+    // accepting changes outside of the save does not hide the change
+    child->setObjectName("Renamed");
+    package.acceptChangesRecursively();
+    EXPECT_TRUE(state.needsSaving("mod", package));
+
+    // reverting the change restores the saved data
+    child->setObjectName("Child");
+    EXPECT_FALSE(state.needsSaving("mod", package));
+}
+
+TEST_F(TestGtModuleSaveState, remove)
+{
+    state.setSaved("mod", "file1", package);
+    state.setSaved("other", "file2", package);
+
+    state.remove("mod");
+    EXPECT_TRUE(state.fileHash("mod").isEmpty());
+    EXPECT_TRUE(state.needsSaving("mod", package));
+    EXPECT_FALSE(state.needsSaving("other", package));
+
+    state.clear();
+    EXPECT_TRUE(state.needsSaving("other", package));
+}
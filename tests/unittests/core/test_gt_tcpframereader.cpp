@@ -0,0 +1,123 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_tcpframereader.h"
+
+#include <QDomDocument>
+
+#include <cctype>
+
+class TestGtTcpFrameReader : public testing::Test
+{
+protected:
+
+    GtTcpFrameReader reader;
+
+    GtTcpFrameReader::Frame frame;
+};
+
+TEST_F(TestGtTcpFrameReader, sizePrefixedFrames)
+{
+    reader.append("5hello3abc");
+
+    ASSERT_EQ(reader.readFrame(frame), GtTcpFrameReader::FrameRead);
+    EXPECT_FALSE(frame.binary);
+    EXPECT_EQ(frame.type, gt::tcp::DataFrame);
+    EXPECT_EQ(frame.payload, "hello");
+
+    ASSERT_EQ(reader.readFrame(frame), GtTcpFrameReader::FrameRead);
+    EXPECT_EQ(frame.payload, "abc");
+
+    EXPECT_TRUE(reader.isEmpty());
+    EXPECT_EQ(reader.readFrame(frame), GtTcpFrameReader::Incomplete);
+}
+
+TEST_F(TestGtTcpFrameReader, binaryFrames)
+{
+    reader.append(gt::tcp::frameHeader(gt::tcp::HelloFrame, 0));
+    reader.append(gt::tcp::frameHeader(gt::tcp::DataFrame, 5) + "hello");
+
+    ASSERT_EQ(reader.readFrame(frame), GtTcpFrameReader::FrameRead);
+    EXPECT_TRUE(frame.binary);
+    EXPECT_EQ(frame.type, gt::tcp::HelloFrame);
+    EXPECT_TRUE(frame.payload.isEmpty());
+
+    ASSERT_EQ(reader.readFrame(frame), GtTcpFrameReader::FrameRead);
+    EXPECT_TRUE(frame.binary);
+    EXPECT_EQ(frame.type, gt::tcp::DataFrame);
+    EXPECT_EQ(frame.payload, "hello");
+
+    EXPECT_TRUE(reader.isEmpty());
+}
+
+TEST_F(TestGtTcpFrameReader, helloMessage)
+{
+    QByteArray hello = gt::tcp::helloMessage();
+
+    // peers not supporting binary frames read a size prefixed xml message
+    int digits = 0;
+    while (digits < hello.size() && std::isdigit(hello.at(digits))) ++digits;
+
+    ASSERT_GT(digits, 0);
+    EXPECT_EQ(hello.left(digits).toInt(), hello.size() - digits);
+
+    QDomDocument doc;
+    ASSERT_TRUE(doc.setContent(hello.mid(digits)));
+    EXPECT_EQ(doc.documentElement().tagName(), "object");
+
+    reader.append(hello + "5hello");
+
+    ASSERT_EQ(reader.readFrame(frame), GtTcpFrameReader::FrameRead);
+    EXPECT_FALSE(frame.binary);
+    EXPECT_EQ(frame.type, gt::tcp::HelloFrame);
+
+    ASSERT_EQ(reader.readFrame(frame), GtTcpFrameReader::FrameRead);
+    EXPECT_EQ(frame.type, gt::tcp::DataFrame);
+    EXPECT_EQ(frame.payload, "hello");
+}
+
+TEST_F(TestGtTcpFrameReader, incompleteFrames)
+{
+    QByteArray data = gt::tcp::frameHeader(gt::tcp::DataFrame, 5) + "hello";
+
+    // header incomplete
+    reader.append(data.left(10));
+    EXPECT_EQ(reader.readFrame(frame), GtTcpFrameReader::Incomplete);
+
+    // payload incomplete
+    reader.append(data.mid(10, 8));
+    EXPECT_EQ(reader.readFrame(frame), GtTcpFrameReader::Incomplete);
+
+    reader.append(data.mid(18));
+    ASSERT_EQ(reader.readFrame(frame), GtTcpFrameReader::FrameRead);
+    EXPECT_EQ(frame.payload, "hello");
+
+    // size prefix may be split
+    reader.append("1");
+    EXPECT_EQ(reader.readFrame(frame), GtTcpFrameReader::Incomplete);
+    reader.append("2hello world!");
+    ASSERT_EQ(reader.readFrame(frame), GtTcpFrameReader::FrameRead);
+    EXPECT_EQ(frame.payload, "hello world!");
+}
+
+TEST_F(TestGtTcpFrameReader, invalidFrames)
+{
+    reader.append(QByteArray(gt::tcp::S_FRAME_HEADER_SIZE, 'x'));
+    EXPECT_EQ(reader.readFrame(frame), GtTcpFrameReader::Invalid);
+
+    reader.clear();
+    EXPECT_TRUE(reader.isEmpty());
+
+    // size too large
+    reader.append("123456789012hello");
+    EXPECT_EQ(reader.readFrame(frame), GtTcpFrameReader::Invalid);
+
+    reader.clear();
+    reader.append(gt::tcp::frameHeader(gt::tcp::DataFrame, -1));
+    EXPECT_EQ(reader.readFrame(frame), GtTcpFrameReader::Invalid);
+}
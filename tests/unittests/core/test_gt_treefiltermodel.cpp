@@ -0,0 +1,169 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_treefiltermodel.h"
+
+#include <QStandardItemModel>
+
+class TestGtTreeFilterModel : public testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        auto* alpha = new QStandardItem(QStringLiteral("alpha"));
+        auto* beta = new QStandardItem(QStringLiteral("beta"));
+        beta->appendRow(new QStandardItem(QStringLiteral("gamma")));
+        beta->appendRow(new QStandardItem(QStringLiteral("gamut")));
+        alpha->appendRow(beta);
+
+        auto* delta = new QStandardItem(QStringLiteral("delta"));
+        delta->appendRow(new QStandardItem(QStringLiteral("epsilon")));
+
+        source.appendRow(alpha);
+        source.appendRow(delta);
+
+        model.setSourceModel(&source);
+    }
+
+    /// Returns the names of all visible items in depth first order
+    QStringList visibleItems(const QModelIndex& parent = {}) const
+    {
+        QStringList retval;
+        for (int row = 0; row < model.rowCount(parent); ++row)
+        {
+            QModelIndex index = model.index(row, 0, parent);
+            retval << index.data().toString() << visibleItems(index);
+        }
+        return retval;
+    }
+
+    QStandardItemModel source;
+
+    GtTreeFilterModel model;
+};
+
+TEST_F(TestGtTreeFilterModel, matchesAndAncestors)
+{
+    EXPECT_EQ(visibleItems().size(), 6);
+
+    model.filterData(QStringLiteral("gam"));
+    EXPECT_EQ(visibleItems(), (QStringList{"alpha", "beta", "gamma"}));
+
+    model.filterData(QStringLiteral("EPS"));
+    EXPECT_EQ(visibleItems(), (QStringList{"delta", "epsilon"}));
+
+    // regular expressions
+    model.filterData(QStringLiteral("^(beta|delta)$"));
+    EXPECT_EQ(visibleItems(), (QStringList{"alpha", "beta", "delta"}));
+
+    model.filterData(QString());
+    EXPECT_EQ(visibleItems().size(), 6);
+}
+
+TEST_F(TestGtTreeFilterModel, refinedFilter)
+{
+    model.filterData(QStringLiteral("a"));
+    EXPECT_EQ(visibleItems().size(), 5);
+
+    model.filterData(QStringLiteral("ga"));
+    EXPECT_EQ(visibleItems(),
+              (QStringList{"alpha", "beta", "gamma", "gamut"}));
+
+    model.filterData(QStringLiteral("gamu"));
+    EXPECT_EQ(visibleItems(), (QStringList{"alpha", "beta", "gamut"}));
+
+    model.filterData(QStringLiteral("gamx"));
+    EXPECT_TRUE(visibleItems().isEmpty());
+
+    // filter is widened again
+    model.filterData(QStringLiteral("g"));
+    EXPECT_EQ(visibleItems(),
+              (QStringList{"alpha", "beta", "gamma", "gamut"}));
+}
+
+TEST_F(TestGtTreeFilterModel, sourceChanged)
+{
+    model.filterData(QStringLiteral("gam"));
+    EXPECT_EQ(visibleItems(), (QStringList{"alpha", "beta", "gamma"}));
+
+    source.item(1)->setText(QStringLiteral("gamma2"));
+    EXPECT_EQ(visibleItems(),
+              (QStringList{"alpha", "beta", "gamma", "gamma2"}));
+
+    source.appendRow(new QStandardItem(QStringLiteral("gamma3")));
+    EXPECT_EQ(visibleItems(),
+              (QStringList{"alpha", "beta", "gamma", "gamma2", "gamma3"}));
+
+    source.removeRow(0);
+    EXPECT_EQ(visibleItems(), (QStringList{"gamma2", "gamma3"}));
+}
+
+TEST_F(TestGtTreeFilterModel, rootIndex)
+{
+    model.setRootIndex(source.item(0)->index());
+
+    // items outside of the root are rejected
+    model.filterData(QStringLiteral("a"));
+    EXPECT_EQ(visibleItems(),
+              (QStringList{"alpha", "beta", "gamma", "gamut"}));
+
+    // the root is always accepted
+    model.filterData(QStringLiteral("eps"));
+    EXPECT_EQ(visibleItems(), QStringList{"alpha"});
+
+    model.setRootIndex(QModelIndex());
+    EXPECT_EQ(visibleItems(), (QStringList{"delta", "epsilon"}));
+}
+
+namespace
+{
+
+/// Accepts only items starting with "g"
+class TestIndexedFilterModel : public GtTreeFilterModel
+{
+protected:
+
+    bool filterAcceptsRow(int source_row,
+                          const QModelIndex& source_parent) const override
+    {
+        return filterAcceptsIndexedRow(source_row, source_parent);
+    }
+
+    bool acceptsSourceIndex(const QModelIndex& source_index) const override
+    {
+        return source_index.data().toString().startsWith('g');
+    }
+};
+
+} // namespace
+
+TEST_F(TestGtTreeFilterModel, emptyFilter)
+{
+    TestIndexedFilterModel indexed;
+    indexed.setSourceModel(&source);
+
+    auto visible = [&indexed](const QModelIndex& parent) {
+        QStringList retval;
+        for (int row = 0; row < indexed.rowCount(parent); ++row)
+        {
+            retval << indexed.index(row, 0, parent).data().toString();
+        }
+        return retval;
+    };
+
+    // the subtrees are searched without a filter index
+    EXPECT_EQ(visible({}), QStringList{"alpha"});
+
+    QModelIndex beta = indexed.index(0, 0, indexed.index(0, 0));
+    EXPECT_EQ(visible(beta), (QStringList{"gamma", "gamut"}));
+
+    indexed.filterData(QStringLiteral("mut"));
+    beta = indexed.index(0, 0, indexed.index(0, 0));
+    EXPECT_EQ(visible(beta), QStringList{"gamut"});
+}
@@ -35,6 +35,7 @@ TestExternalizedObjectData::setValues(const QVector<double>  &values) &
 {
     assert(m_base);
     base()->m_values = values;
+    setModified();
 }
 
 const QStringList&
@@ -49,6 +50,7 @@ TestExternalizedObjectData::setParams(const QStringList& params) &
 {
     assert(m_base);
     base()->m_params = params;
+    setModified();
 }
 
 void
@@ -57,6 +59,7 @@ TestExternalizedObjectData::setInitialValues(const QVector<double>& values) &
     assert(m_base);
     base()->m_values = values;
     base()->m_initialValues = values;
+    setModified();
 }
 
 
@@ -66,6 +69,7 @@ TestExternalizedObjectData::setInitialParams(const QStringList& params) &
     assert(m_base);
     base()->m_params = params;
     base()->m_initialParams = params;
+    setModified();
 }
 
 void
@@ -73,6 +77,7 @@ TestExternalizedObjectData::clearValues() &
 {
     assert(m_base);
     base()->m_values.clear();
+    setModified();
 }
 
 const QVector<double>&
@@ -126,4 +126,17 @@ private:
     QStringList m_initialParams;
 };
 
+/// Externalized object tracking its modifications explicitly
+class TestTrackedExternalizedObject : public TestExternalizedObject
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE TestTrackedExternalizedObject()
+    {
+        enableModificationTracking();
+    }
+};
+
 #endif // TEST_EXTERNALOBECT_H
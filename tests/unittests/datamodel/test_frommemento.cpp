@@ -198,6 +198,64 @@ TEST_F(TestFromMemento, mergeObject)
     EXPECT_EQ(123., child2->getDouble());
 }
 
+TEST_F(TestFromMemento, mergeWideObject)
+{
+    constexpr int n = 200;
+
+    TestSpecialGtObject source;
+    TestSpecialGtObject target;
+    QList<GtObject*> kept;
+
+    for (int i = 0; i < n; ++i)
+    {
+        auto child = new TestSpecialGtObject;
+        child->setObjectName(QStringLiteral("child_%1").arg(i));
+        child->setDouble(i);
+        source.appendChild(child);
+
+        // every second child exists in the target
+        if (i % 2 == 0)
+        {
+            auto existing = new TestSpecialGtObject;
+            existing->setObjectName(child->objectName());
+            existing->setUuid(child->uuid());
+            target.appendChild(existing);
+            kept.append(existing);
+        }
+    }
+
+    // children with the same ident are merged in order
+    auto duplicate = new TestSpecialGtObject;
+    duplicate->setObjectName(QStringLiteral("child_0"));
+    source.appendChild(duplicate);
+
+    // stale children are deleted
+    auto stale = new TestSpecialGtObject;
+    stale->setObjectName(QStringLiteral("stale"));
+    target.appendChild(stale);
+
+    auto memento = source.toMemento();
+    ASSERT_TRUE(memento.mergeTo(target, *GtObjectFactory::instance()));
+
+    auto children = target.findDirectChildren<TestSpecialGtObject*>();
+    ASSERT_EQ(children.size(), n + 1);
+
+    // existing children are kept in front
+    for (int i = 0; i < kept.size(); ++i)
+    {
+        EXPECT_EQ(children[i], kept[i]);
+    }
+
+    for (auto* child : source.findDirectChildren<TestSpecialGtObject*>())
+    {
+        auto* merged = target.getDirectChildByUuid(child->uuid());
+        ASSERT_NE(merged, nullptr);
+        EXPECT_EQ(merged->objectName(), child->objectName());
+        EXPECT_EQ(static_cast<TestSpecialGtObject*>(merged)->getDouble(),
+                  child->getDouble());
+    }
+}
+
 TEST_F(TestFromMemento, mergeNonMatchingObject)
 {
     GtObject o;
@@ -58,6 +58,37 @@ TEST_F(TestGtDoubleListProperty, setterGetter)
     }
 }
 
+TEST_F(TestGtDoubleListProperty, unitConversion)
+{
+    GtDoubleListProperty prop("prop", "prop", "brief", GtUnit::Length,
+                              {1.0, 2.5, -3.0});
+
+    bool ok = false;
+    QVector<double> mm = prop.getVal("mm", &ok);
+
+    ASSERT_TRUE(ok);
+    ASSERT_EQ(mm, (QVector<double>{1000.0, 2500.0, -3000.0}));
+
+    QVariant var = prop.valueToVariant("km", &ok);
+    ASSERT_TRUE(ok);
+    ASSERT_DOUBLE_EQ(var.value<QVector<double>>()[1], 0.0025);
+
+    prop.setVal({100.0, 250.0}, "cm", &ok);
+    ASSERT_TRUE(ok);
+    ASSERT_EQ(prop.getVal(), (QVector<double>{1.0, 2.5}));
+
+    // invalid unit
+    prop.setVal({1.0}, "°C", &ok);
+    ASSERT_FALSE(ok);
+    ASSERT_EQ(prop.getVal(), (QVector<double>{1.0, 2.5}));
+
+    // values without unit category are not converted
+    GtDoubleListProperty noUnit("prop", "prop");
+    noUnit.setVal({1.0, 2.0}, "mm", &ok);
+    ASSERT_TRUE(ok);
+    ASSERT_EQ(noUnit.getVal("mm"), (QVector<double>{1.0, 2.0}));
+}
+
 TEST_F(TestGtDoubleListProperty, memento)
 {
     gtObjectFactory->registerClass(TestDoubleListObject::staticMetaObject);
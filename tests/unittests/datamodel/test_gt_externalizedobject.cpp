@@ -370,6 +370,61 @@ TEST_F(TestGtExternalizedObject, hasModifiedData)
     }
 }
 
+/// Objects tracking their modifications are only scheduled for
+/// externalization if their data was written
+TEST_F(TestGtExternalizedObject, modificationTracking)
+{
+    TestTrackedExternalizedObject tracked;
+    tracked.setObjectName("Tracked");
+    ASSERT_TRUE(tracked.tracksModifications());
+
+    { // new data is modified
+        auto data = tracked.fetchData();
+        data.setValues(m_values);
+    }
+
+    EXPECT_TRUE(tracked.isFetched());
+    EXPECT_TRUE(tracked.hasModifiedData());
+
+    EXPECT_TRUE(tracked.externalize());
+    EXPECT_FALSE(tracked.isFetched());
+    EXPECT_FALSE(tracked.hasModifiedData());
+
+    // reading does not modify the data
+    for (int i = 0; i < 3; ++i)
+    {
+        {
+            auto data = tracked.fetchData();
+            EXPECT_EQ(data.values(), m_values);
+        }
+
+        EXPECT_FALSE(tracked.isFetched());
+        EXPECT_FALSE(tracked.hasModifiedData());
+    }
+
+    { // writing does
+        auto data = tracked.fetchData();
+        data.clearValues();
+    }
+
+    EXPECT_TRUE(tracked.isFetched());
+    EXPECT_TRUE(tracked.hasModifiedData());
+
+    EXPECT_TRUE(tracked.externalize());
+    EXPECT_FALSE(tracked.isFetched());
+    EXPECT_FALSE(tracked.hasModifiedData());
+
+    { // changing properties modifies the object
+        auto data = tracked.fetchData();
+        EXPECT_FALSE(tracked.hasModifiedData());
+
+        tracked.setObjectName("Renamed");
+        EXPECT_TRUE(tracked.hasModifiedData());
+    }
+
+    EXPECT_TRUE(tracked.isFetched());
+}
+
 /// Once an externalized object was externalized and thus had written
 /// modified data to disk it should no longer fetch its initial version but the
 /// modified one
@@ -389,6 +444,41 @@ TEST_F(TestGtExternalizedObject, fetchIntialVersion)
     EXPECT_FALSE(obj->fetchInitialVersion());
 }
 
+namespace
+{
+
+/// Externalized object without meta properties, hence its hash is cached
+class PlainExternalizedObject : public GtExternalizedObject
+{
+protected:
+    bool doFetchData(QVariant&, bool) override { return true; }
+
+    bool doExternalizeData(QVariant&) override { return true; }
+
+    void doClearExternalizedData() override {}
+};
+
+} // namespace
+
+/// the cached object hash is invalidated by updating the external hash
+TEST_F(TestGtExternalizedObject, contentHashAfterExternalize)
+{
+    PlainExternalizedObject ext;
+    ext.setObjectName("Plain");
+
+    QByteArray hash = ext.contentHash();
+
+    ASSERT_TRUE(ext.isFetched());
+    ASSERT_TRUE(ext.externalize());
+    EXPECT_FALSE(ext.extHash().isEmpty());
+
+    GtObjectMemento memento = ext.toMemento();
+    memento.calculateHashes();
+
+    EXPECT_NE(ext.contentHash(), hash);
+    EXPECT_EQ(ext.contentHash(), memento.fullHash());
+}
+
 TEST_F(TestGtExternalizedObject, memento_externalization_info)
 {
     // before externalization
@@ -0,0 +1,130 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "internal/gt_listconversion.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+class TestGtListConversion : public testing::Test
+{
+protected:
+
+    static QString format(double value)
+    {
+        QChar buffer[gt::detail::S_MAX_DOUBLE_CHARS];
+        int n = gt::detail::formatDouble(value, buffer);
+        return QString(buffer, n);
+    }
+
+    static double parse(const QString& str)
+    {
+        return gt::detail::parseDouble(str.constData(),
+                                       str.constData() + str.size());
+    }
+};
+
+TEST_F(TestGtListConversion, formatDouble)
+{
+    // same output as before for values having up to 15 significant digits
+    for (double value : {0.0, 1.0, -2.5, 100.0, 0.1, 1e-5, 1.5e-7, 1e15,
+                         2e15, 123456789012345.0, 0.0001, 1e300, -3.75e-300,
+                         42.125})
+    {
+        EXPECT_EQ(format(value), QString::number(value, 'g', 15));
+    }
+
+    EXPECT_EQ(format(0.1 + 0.2), QStringLiteral("0.30000000000000004"));
+    EXPECT_EQ(format(-0.0), QStringLiteral("-0"));
+    EXPECT_EQ(format(std::numeric_limits<double>::infinity()),
+              QStringLiteral("inf"));
+    EXPECT_EQ(format(std::numeric_limits<double>::quiet_NaN()),
+              QStringLiteral("nan"));
+}
+
+TEST_F(TestGtListConversion, roundTrip)
+{
+    std::mt19937_64 rng(42);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        quint64 bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (std::isnan(value)) continue;
+
+        double result = parse(format(value));
+        EXPECT_EQ(std::memcmp(&value, &result, sizeof(value)), 0)
+            << format(value).toStdString();
+    }
+}
+
+TEST_F(TestGtListConversion, parseDouble)
+{
+    EXPECT_EQ(parse("1.5"), 1.5);
+    EXPECT_EQ(parse("-0.125e2"), -12.5);
+    EXPECT_EQ(parse("1E-3"), 1e-3);
+    EXPECT_EQ(parse("12345678901234567890"), 12345678901234567890.0);
+    EXPECT_EQ(parse(" 2.5 "), 2.5);
+    EXPECT_EQ(parse("abc"), 0.0);
+    EXPECT_EQ(parse(""), 0.0);
+    EXPECT_TRUE(std::isinf(parse("inf")));
+}
+
+TEST_F(TestGtListConversion, lists)
+{
+    QVector<double> doubles{1.0, 0.1 + 0.2, -1e-20, 3.0};
+    EXPECT_EQ(gt::detail::doubleListFromString(
+                  gt::detail::listToString(doubles)), doubles);
+
+    QList<int> ints{0, -1, 42, std::numeric_limits<int>::min(),
+                    std::numeric_limits<int>::max()};
+    EXPECT_EQ(gt::detail::listToString(ints),
+              QStringLiteral("0;-1;42;-2147483648;2147483647"));
+    EXPECT_EQ(gt::detail::intListFromString(
+                  gt::detail::listToString(ints)), ints);
+
+    QList<bool> bools{true, false, true};
+    EXPECT_EQ(gt::detail::listToString(bools),
+              QStringLiteral("true;false;true"));
+    EXPECT_EQ(gt::detail::boolListFromString("true;false;FALSE;0;1;;x"),
+              (QList<bool>{true, false, false, false, true, true}));
+
+    QList<QPointF> points{{1.0, 2.5}, {-0.5, 1e20}};
+    EXPECT_EQ(gt::detail::listToString(points),
+              QStringLiteral("1_2.5;-0.5_1e+20"));
+    EXPECT_EQ(gt::detail::pointListFromString(
+                  gt::detail::listToString(points)), points);
+
+    // invalid points are skipped
+    EXPECT_EQ(gt::detail::pointListFromString("1_2;;3;4_5_6;7_8"),
+              (QList<QPointF>{{1.0, 2.0}, {7.0, 8.0}}));
+
+    // empty entries are skipped
+    EXPECT_EQ(gt::detail::doubleListFromString(";1;;2;"),
+              (QVector<double>{1.0, 2.0}));
+
+    EXPECT_TRUE(gt::detail::listToString(QVector<double>{}).isEmpty());
+    EXPECT_TRUE(gt::detail::doubleListFromString(QString{}).isEmpty());
+}
+
+TEST_F(TestGtListConversion, largeList)
+{
+    // large enough to be parsed in parallel
+    QVector<double> list;
+    for (int i = 0; i < 200000; ++i)
+    {
+        list.append(i * 0.001 - 7.0);
+    }
+
+    EXPECT_EQ(gt::detail::doubleListFromString(
+                  gt::detail::listToString(list)), list);
+}
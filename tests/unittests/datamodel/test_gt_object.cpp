@@ -15,10 +15,33 @@
 #include "gt_objectmemento.h"
 
 #include "gt_labeldata.h"
+#include "gt_label.h"
 
 #include "slotadaptor.h"
+#include <QUuid>
 #include <QtConcurrent/QtConcurrent>
 
+#include <algorithm>
+
+namespace
+{
+
+/// Object having a silent property
+class SilentPropertyObject : public GtObjectGroup
+{
+public:
+
+    SilentPropertyObject() :
+        silentProp("silentProp", "Silent Int")
+    {
+        registerSilentProperty(silentProp);
+    }
+
+    GtIntProperty silentProp;
+};
+
+} // namespace
+
 /// This is a test fixture that does a init for each test
 class TestGtObject : public ::testing::Test
 {
@@ -248,6 +271,46 @@ TEST_F(TestGtObject, insertChild)
     delete parentObject;
 }
 
+TEST_F(TestGtObject, insertChildKeepsIndex)
+{
+    obj.enableUuidIndex();
+
+    auto* child1 = new GtObjectGroup(&obj);
+    auto* child2 = new GtObjectGroup(&obj);
+    auto* subChild = new GtObjectGroup(child2);
+    subChild->setObjectName("SubChild");
+
+    auto* inserted = new GtObjectGroup;
+    ASSERT_TRUE(obj.insertChild(1, inserted));
+
+    EXPECT_EQ(obj.childObjects(),
+              (QVector<GtObject*>{child1, inserted, child2}));
+
+    // moved subtrees are still indexed
+    EXPECT_TRUE(subChild->hasUuidIndex());
+    EXPECT_EQ(obj.getObjectByUuid(subChild->uuid()), subChild);
+    EXPECT_EQ(obj.getObjectByUuid(inserted->uuid()), inserted);
+    EXPECT_EQ(child2->getObjectByUuid(subChild->uuid()), subChild);
+}
+
+TEST_F(TestGtObject, moveWithinIndexedTree)
+{
+    obj.enableUuidIndex();
+
+    auto* group1 = new GtObjectGroup(&obj);
+    auto* group2 = new GtObjectGroup(&obj);
+    auto* child = new GtObjectGroup(group1);
+    auto* subChild = new GtObjectGroup(child);
+
+    // the subtree stays in the same index
+    ASSERT_TRUE(group2->appendChild(child));
+
+    EXPECT_EQ(obj.getObjectByUuid(child->uuid()), child);
+    EXPECT_EQ(obj.getObjectByUuid(subChild->uuid()), subChild);
+    EXPECT_EQ(group2->getObjectByUuid(subChild->uuid()), subChild);
+    EXPECT_EQ(group1->getObjectByUuid(subChild->uuid()), nullptr);
+}
+
 TEST_F(TestGtObject, isDerivedFromClass)
 {
     GtLabelData label;
@@ -469,3 +532,468 @@ TEST_F(TestGtObject, bug539)
     EXPECT_EQ(parent.findDirectChildren<TestObject*>().size(), 1);
     EXPECT_EQ(parent.findDirectChildren<TestSpecialGtObject*>().size(), 1);
 }
+
+TEST_F(TestGtObject, uuidIndex)
+{
+    obj.enableUuidIndex();
+    ASSERT_TRUE(obj.hasUuidIndex());
+
+    auto* child1 = new GtObjectGroup(&obj);
+    auto* child2 = new GtObjectGroup(child1);
+    ASSERT_TRUE(child2->hasUuidIndex());
+
+    EXPECT_EQ(obj.getObjectByUuid(obj.uuid()), &obj);
+    EXPECT_EQ(obj.getObjectByUuid(child1->uuid()), child1);
+    EXPECT_EQ(obj.getObjectByUuid(child2->uuid()), child2);
+    EXPECT_EQ(child1->getObjectByUuid(child2->uuid()), child2);
+    // only descendants are found
+    EXPECT_EQ(child1->getObjectByUuid(obj.uuid()), nullptr);
+
+    EXPECT_EQ(obj.getDirectChildByUuid(child1->uuid()), child1);
+    EXPECT_EQ(obj.getDirectChildByUuid(child2->uuid()), nullptr);
+
+    // uuid changes
+    QString oldUuid = child2->uuid();
+    child2->setUuid(QStringLiteral("my_uuid"));
+    EXPECT_EQ(obj.getObjectByUuid(oldUuid), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("my_uuid")), child2);
+
+    child2->newUuid();
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("my_uuid")), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(child2->uuid()), child2);
+
+    // reparenting
+    auto* other = new GtObjectGroup;
+    other->appendChild(child1);
+    EXPECT_FALSE(child2->hasUuidIndex());
+    EXPECT_EQ(obj.getObjectByUuid(child1->uuid()), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(child2->uuid()), nullptr);
+    EXPECT_EQ(other->getObjectByUuid(child2->uuid()), child2);
+
+    obj.appendChild(other);
+    EXPECT_TRUE(child2->hasUuidIndex());
+    EXPECT_EQ(obj.getObjectByUuid(child2->uuid()), child2);
+
+    // destruction
+    QString uuid1 = child1->uuid();
+    QString uuid2 = child2->uuid();
+    delete child1;
+    EXPECT_EQ(obj.getObjectByUuid(uuid1), nullptr);
+    EXPECT_EQ(obj.getObjectByUuid(uuid2), nullptr);
+}
+
+TEST_F(TestGtObject, uuidIndexDuplicates)
+{
+    obj.enableUuidIndex();
+
+    auto* child1 = new GtObjectGroup(&obj);
+    auto* child2 = new GtObjectGroup(&obj);
+    auto* child3 = new GtObjectGroup(child2);
+
+    // clone uuid within the same tree
+    child3->setUuid(child1->uuid());
+
+    // ambiguous uuid falls back to the tree order
+    EXPECT_EQ(obj.getObjectByUuid(child1->uuid()), child1);
+    EXPECT_EQ(child2->getObjectByUuid(child1->uuid()), child3);
+}
+
+TEST_F(TestGtObject, uuidFormats)
+{
+    GtObjectGroup o;
+
+    // uuid is generated on first access
+    EXPECT_FALSE(o.hasUuid(QString()));
+    QString const uuid = o.uuid();
+    EXPECT_FALSE(QUuid(uuid).isNull());
+    EXPECT_EQ(o.uuid(), uuid);
+    EXPECT_TRUE(o.hasUuid(uuid));
+
+    GtObjectGroup other;
+    EXPECT_NE(other.uuid(), uuid);
+
+    // uuids in any other format are kept as they are
+    for (QString const& custom : {QStringLiteral("my_uuid"),
+                                  uuid.toUpper(),
+                                  uuid.mid(1, 36)})
+    {
+        o.setUuid(custom);
+        EXPECT_EQ(o.uuid(), custom);
+        EXPECT_TRUE(o.hasUuid(custom));
+        EXPECT_FALSE(o.hasUuid(uuid));
+    }
+
+    o.setUuid(uuid);
+    EXPECT_EQ(o.uuid(), uuid);
+
+    // objects restored from a memento keep their uuid
+    obj.enableUuidIndex();
+    auto* child = new GtObjectGroup(&o);
+    child->setUuid(QStringLiteral("child_uuid"));
+
+    GtObject* restored = o.toMemento().toObject(*gtObjectFactory, &obj);
+    ASSERT_TRUE(restored);
+    EXPECT_EQ(restored->parent(), &obj);
+    EXPECT_EQ(obj.getObjectByUuid(uuid), restored);
+    EXPECT_EQ(obj.getObjectByUuid(QStringLiteral("child_uuid"))->parent(),
+              restored);
+}
+
+TEST_F(TestGtObject, labelIndex)
+{
+    auto check = [](GtObject& root) {
+        auto* child = new GtObjectGroup;
+        root.appendChild(child);
+
+        auto* label1 = new GtLabel(QStringLiteral("A"));
+        auto* label2 = new GtLabel(QStringLiteral("A"));
+        auto* label3 = new GtLabel(QStringLiteral("B"));
+        root.appendChild(label1);
+        child->appendChild(label2);
+        child->appendChild(label3);
+
+        EXPECT_EQ(root.findLabels(QStringLiteral("A")).size(), 2);
+        EXPECT_EQ(root.findLabels(QStringLiteral("B")),
+                  QList<GtLabel*>{label3});
+        // only descendants are found
+        EXPECT_EQ(child->findLabels(QStringLiteral("A")),
+                  QList<GtLabel*>{label2});
+
+        // renaming
+        label2->setObjectName(QStringLiteral("B"));
+        EXPECT_EQ(root.findLabels(QStringLiteral("A")),
+                  QList<GtLabel*>{label1});
+        EXPECT_EQ(root.findLabels(QStringLiteral("B")).size(), 2);
+
+        // removing
+        GtObjectGroup other;
+        other.appendChild(label3);
+        EXPECT_EQ(root.findLabels(QStringLiteral("B")),
+                  QList<GtLabel*>{label2});
+        EXPECT_EQ(other.findLabels(QStringLiteral("B")),
+                  QList<GtLabel*>{label3});
+
+        // deleting
+        delete label1;
+        EXPECT_TRUE(root.findLabels(QStringLiteral("A")).isEmpty());
+    };
+
+    // without index
+    GtObjectGroup root;
+    check(root);
+
+    // with index
+    GtObjectGroup indexedRoot;
+    indexedRoot.enableUuidIndex();
+    check(indexedRoot);
+}
+
+TEST_F(TestGtObject, classIndex)
+{
+    auto sorted = [](auto list) {
+        std::sort(list.begin(), list.end());
+        return list;
+    };
+
+    auto check = [&](GtObject& root) {
+        auto* child = new GtObjectGroup;
+        root.appendChild(child);
+
+        auto* label1 = new GtLabel(QStringLiteral("A"));
+        auto* label2 = new GtLabel(QStringLiteral("B"));
+        root.appendChild(label1);
+        child->appendChild(label2);
+
+        // appended while being constructed
+        auto* group = new GtObjectGroup(child);
+
+        EXPECT_EQ(sorted(root.findDescendants<GtLabel*>()),
+                  sorted(QList<GtLabel*>{label1, label2}));
+        EXPECT_EQ(sorted(root.findDescendants<GtObjectGroup*>()),
+                  sorted(QList<GtObjectGroup*>{child, group}));
+        EXPECT_EQ(root.findDescendants().size(), 4);
+        // only descendants are found
+        EXPECT_EQ(child->findDescendants<GtLabel*>(),
+                  QList<GtLabel*>{label2});
+        EXPECT_EQ(sorted(root.findDescendants<GtObject*>()),
+                  sorted(root.findChildren<GtObject*>()));
+
+        // removing
+        GtObjectGroup other;
+        other.appendChild(child);
+        EXPECT_EQ(root.findDescendants<GtLabel*>(),
+                  QList<GtLabel*>{label1});
+        EXPECT_EQ(other.findDescendants<GtLabel*>(),
+                  QList<GtLabel*>{label2});
+
+        // deleting
+        delete label1;
+        EXPECT_TRUE(root.findDescendants<GtLabel*>().isEmpty());
+    };
+
+    // without index
+    GtObjectGroup root;
+    check(root);
+    EXPECT_FALSE(root.hasClassIndex());
+
+    // with index
+    GtObjectGroup indexedRoot;
+    indexedRoot.enableClassIndex();
+    EXPECT_TRUE(indexedRoot.hasClassIndex());
+    EXPECT_TRUE(indexedRoot.hasUuidIndex());
+    check(indexedRoot);
+
+    // enabling the index for an existing tree
+    GtObjectGroup tree;
+    tree.enableUuidIndex();
+    auto* label = new GtLabel(QStringLiteral("A"));
+    tree.appendChild(new GtObjectGroup);
+    tree.childObjects().first()->appendChild(label);
+
+    tree.childObjects().first()->enableClassIndex();
+    EXPECT_TRUE(tree.hasClassIndex());
+    EXPECT_EQ(tree.findDescendants<GtLabel*>(), QList<GtLabel*>{label});
+}
+
+TEST_F(TestGtObject, classIndexConcurrentQueries)
+{
+    GtObjectGroup root;
+    root.enableClassIndex();
+
+    // appended while being constructed
+    for (int i = 0; i < 100; ++i)
+    {
+        auto* group = new GtObjectGroup(&root);
+        new GtObject(group);
+    }
+
+    QList<int> counts = QtConcurrent::blockingMapped(
+        QList<int>{0, 1, 2, 3, 4, 5, 6, 7}, [&root](int) {
+            return root.findDescendants<GtObjectGroup*>().size();
+    });
+
+    for (int n : qAsConst(counts))
+    {
+        EXPECT_EQ(n, 100);
+    }
+
+    // plain objects stay registered as such
+    EXPECT_EQ(root.findDescendants<GtObject*>().size(), 200);
+    EXPECT_EQ(root.findDescendants<GtObjectGroup*>().size(), 100);
+}
+
+TEST_F(TestGtObject, classIndexQueryWhileConstructing)
+{
+    GtObjectGroup root;
+    root.enableClassIndex();
+
+    int found = -1;
+    QObject::connect(&root, &GtObject::childAppended,
+                     [&root, &found](GtObject*, GtObject*) {
+        found = root.findDescendants<GtObjectGroup*>().size();
+    });
+
+    // the group is appended by the constructor of GtObject
+    auto* group = new GtObjectGroup(&root);
+    EXPECT_EQ(found, 0);
+
+    // the group is resolved by the next query
+    EXPECT_EQ(root.findDescendants<GtObjectGroup*>(),
+              QList<GtObjectGroup*>{group});
+}
+
+TEST_F(TestGtObject, relayDirectDataChanges)
+{
+    GtObject::setRelayDirectDataChanges(true);
+    EXPECT_TRUE(GtObject::relayDirectDataChanges());
+
+    GtObjectGroup root;
+    auto* child = new GtObjectGroup;
+    root.appendChild(child);
+    auto* subChild = new GtObjectGroup;
+    child->appendChild(subChild);
+
+    GtObject::setRelayDirectDataChanges(false);
+
+    QList<GtObject*> changes;
+    QObject::connect(&root, qOverload<GtObject*>(&GtObject::dataChanged),
+                     [&changes](GtObject* obj) { changes.append(obj); });
+
+    // directly emitted signals reach the parents
+    emit subChild->dataChanged(subChild);
+    EXPECT_EQ(changes, QList<GtObject*>{subChild});
+
+    // notified changes are delivered once
+    changes.clear();
+    subChild->notifyDataChanged();
+    EXPECT_EQ(changes, QList<GtObject*>{subChild});
+
+    // the relay is removed from the old parent
+    GtObjectGroup other;
+    other.appendChild(subChild);
+    changes.clear();
+    emit subChild->dataChanged(subChild);
+    EXPECT_TRUE(changes.isEmpty());
+}
+
+TEST_F(TestGtObject, uuidIndexRoot)
+{
+    GtObjectGroup root;
+    root.enableUuidIndex();
+
+    auto* subRoot = new GtObjectGroup;
+    subRoot->enableUuidIndex();
+    auto* child = new GtObjectGroup(subRoot);
+
+    root.appendChild(subRoot);
+    EXPECT_EQ(root.getObjectByUuid(child->uuid()), child);
+
+    // the sub root keeps its own index when being detached
+    subRoot->disconnectFromParent();
+    EXPECT_TRUE(subRoot->hasUuidIndex());
+    EXPECT_TRUE(child->hasUuidIndex());
+    EXPECT_EQ(root.getObjectByUuid(child->uuid()), nullptr);
+    EXPECT_EQ(subRoot->getObjectByUuid(child->uuid()), child);
+
+    delete subRoot;
+}
+
+TEST_F(TestGtObject, childObjects)
+{
+    auto* child1 = new GtObjectGroup(&obj);
+    auto* child2 = new GtObjectGroup(&obj);
+    auto* child3 = new GtObjectGroup(&obj);
+
+    ASSERT_EQ(obj.childObjects().size(), 3);
+    EXPECT_EQ(obj.childObjects().at(0), child1);
+    EXPECT_EQ(obj.childObjects().at(2), child3);
+    EXPECT_EQ(child1->childNumber(), 0);
+    EXPECT_EQ(child2->childNumber(), 1);
+    EXPECT_EQ(child3->childNumber(), 2);
+
+    // insert
+    auto* child4 = new GtObjectGroup;
+    ASSERT_TRUE(obj.insertChild(1, child4));
+    EXPECT_EQ(obj.childObjects(), (QVector<GtObject*>{child1, child4,
+                                                       child2, child3}));
+    EXPECT_EQ(child4->childNumber(), 1);
+    EXPECT_EQ(child3->childNumber(), 3);
+
+    // delete
+    delete child1;
+    ASSERT_EQ(obj.childObjects().size(), 3);
+    EXPECT_EQ(child4->childNumber(), 0);
+    EXPECT_EQ(child2->childNumber(), 1);
+
+    // reparent
+    child2->setParent(nullptr);
+    EXPECT_EQ(obj.childObjects(), (QVector<GtObject*>{child4, child3}));
+    EXPECT_EQ(child2->childNumber(), -1);
+    EXPECT_EQ(child3->childNumber(), 1);
+    delete child2;
+
+    // non GtObject children are ignored
+    new QObject(&obj);
+    EXPECT_EQ(obj.childObjects().size(), 2);
+
+    GtObjectGroup const& cobj = obj;
+    EXPECT_EQ(cobj.childObjects().size(), 2);
+}
+
+TEST_F(TestGtObject, moveChildMarksChanges)
+{
+    GtObjectGroup source;
+    GtObjectGroup target;
+
+    auto* child = new GtObjectGroup(&source);
+
+    source.acceptChangesRecursively();
+    target.acceptChangesRecursively();
+    EXPECT_FALSE(source.hasChanges());
+
+    ASSERT_TRUE(target.appendChild(child));
+
+    EXPECT_TRUE(source.hasChanges());
+    EXPECT_TRUE(target.hasChanges());
+}
+
+TEST_F(TestGtObject, contentHash)
+{
+    auto mementoHash = [](const GtObject& o){
+        GtObjectMemento memento = o.toMemento();
+        memento.calculateHashes();
+        return memento.fullHash();
+    };
+
+    auto* child = new GtObjectGroup(&obj);
+    child->setObjectName("Child");
+    auto* subChild = new GtObjectGroup(child);
+    subChild->setObjectName("SubChild");
+
+    QByteArray hash = obj.contentHash();
+    EXPECT_EQ(hash, mementoHash(obj));
+    EXPECT_EQ(obj.calcHash(), QString(hash.toHex()));
+    EXPECT_EQ(obj.contentHash(), hash);
+
+    // own data of a descendant changed
+    subChild->setObjectName("Renamed");
+    EXPECT_NE(obj.contentHash(), hash);
+    EXPECT_EQ(obj.contentHash(), mementoHash(obj));
+    EXPECT_EQ(child->contentHash(), mementoHash(*child));
+
+    // child moved
+    hash = obj.contentHash();
+    ASSERT_TRUE(obj.appendChild(subChild));
+    EXPECT_NE(obj.contentHash(), hash);
+    EXPECT_EQ(obj.contentHash(), mementoHash(obj));
+    EXPECT_EQ(child->contentHash(), mementoHash(*child));
+
+    // child deleted
+    hash = obj.contentHash();
+    delete subChild;
+    EXPECT_NE(obj.contentHash(), hash);
+    EXPECT_EQ(obj.contentHash(), mementoHash(obj));
+
+    // changes of properties and meta properties
+    auto* special = new TestSpecialGtObject;
+    ASSERT_TRUE(child->appendChild(special));
+    EXPECT_EQ(obj.contentHash(), mementoHash(obj));
+
+    special->setDouble(4.0);
+    EXPECT_EQ(obj.contentHash(), mementoHash(obj));
+
+    hash = obj.contentHash();
+    special->setDoubleVec({1., 2.});
+    EXPECT_NE(obj.contentHash(), hash);
+    EXPECT_EQ(obj.contentHash(), mementoHash(obj));
+}
+
+TEST_F(TestGtObject, contentHashOfSilentProperty)
+{
+    auto mementoHash = [](const GtObject& o){
+        GtObjectMemento memento = o.toMemento();
+        memento.calculateHashes();
+        return memento.fullHash();
+    };
+
+    auto* child = new SilentPropertyObject;
+    ASSERT_TRUE(obj.appendChild(child));
+
+    int changes = 0;
+    QObject::connect(child, qOverload<GtObject*, GtAbstractProperty*>(
+                         &GtObject::dataChanged),
+                     [&changes](GtObject*, GtAbstractProperty*) {
+        ++changes;
+    });
+
+    QByteArray hash = obj.contentHash();
+    EXPECT_EQ(hash, mementoHash(obj));
+
+    // the change is not notified but invalidates the hash
+    child->silentProp.setVal(42);
+    EXPECT_EQ(changes, 0);
+
+    EXPECT_NE(obj.contentHash(), hash);
+    EXPECT_EQ(obj.contentHash(), mementoHash(obj));
+    EXPECT_EQ(child->calcHash(), QString(mementoHash(*child).toHex()));
+}
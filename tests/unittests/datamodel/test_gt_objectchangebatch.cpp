@@ -0,0 +1,172 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_objectchangebatch.h"
+#include "gt_objectmementocache.h"
+#include "gt_objectmementodiff.h"
+#include "test_gt_object.h"
+
+/// This is a test fixture that does a init for each test
+class TestGtObjectChangeBatch : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        root.setObjectName("Root");
+
+        child = new TestSpecialGtObject;
+        child->setObjectName("Child");
+        root.appendChild(child);
+
+        QObject::connect(&root, qOverload<GtObject*>(&GtObject::dataChanged),
+                         [this](GtObject* obj) {
+            objectChanges.append(obj);
+        });
+        QObject::connect(&root, qOverload<GtObject*, GtAbstractProperty*>(
+                             &GtObject::dataChanged),
+                         [this](GtObject* obj, GtAbstractProperty*) {
+            propertyChanges.append(obj);
+        });
+    }
+
+    TestSpecialGtObject root;
+    TestSpecialGtObject* child{};
+
+    /// objects, whose dataChanged signals reached the root
+    QList<GtObject*> objectChanges;
+    QList<GtObject*> propertyChanges;
+};
+
+TEST_F(TestGtObjectChangeBatch, coalesced)
+{
+    {
+        GtObjectChangeBatch batch;
+        EXPECT_TRUE(GtObjectChangeBatch::isActive());
+
+        for (int i = 0; i < 100; ++i)
+        {
+            child->setDouble(i);
+            child->setInt(i);
+            root.setDouble(i);
+        }
+        child->setObjectName("Renamed");
+        child->setObjectName("Renamed2");
+
+        EXPECT_TRUE(objectChanges.isEmpty());
+        EXPECT_TRUE(propertyChanges.isEmpty());
+
+        // flags are updated immediately
+        EXPECT_TRUE(child->objectFlags().testFlag(GtObject::HasOwnChanges));
+    }
+
+    EXPECT_FALSE(GtObjectChangeBatch::isActive());
+
+    // one notification per object in the order of the changes
+    EXPECT_EQ(propertyChanges, (QList<GtObject*>{&root}));
+    EXPECT_EQ(objectChanges, (QList<GtObject*>{child}));
+    EXPECT_TRUE(root.objectFlags().testFlag(GtObject::HasChildChanges));
+}
+
+TEST_F(TestGtObjectChangeBatch, onePerObject)
+{
+    int emitted = 0;
+    QObject::connect(child, qOverload<GtObject*>(&GtObject::dataChanged),
+                     [&emitted](GtObject*) { ++emitted; });
+    QObject::connect(child, qOverload<GtObject*, GtAbstractProperty*>(
+                         &GtObject::dataChanged),
+                     [&emitted](GtObject*, GtAbstractProperty*) {
+        ++emitted;
+    });
+
+    {
+        GtObjectChangeBatch batch;
+        child->setBool(true);
+        child->setDouble(1.0);
+        child->setInt(2);
+        child->setString("Batch");
+    }
+
+    EXPECT_EQ(emitted, 1);
+    EXPECT_EQ(objectChanges, (QList<GtObject*>{child}));
+    EXPECT_TRUE(propertyChanges.isEmpty());
+
+    // a single changed property is notified as such
+    emitted = 0;
+    objectChanges.clear();
+
+    {
+        GtObjectChangeBatch batch;
+        child->setDouble(3.0);
+        child->setDouble(4.0);
+    }
+
+    EXPECT_EQ(emitted, 1);
+    EXPECT_TRUE(objectChanges.isEmpty());
+    EXPECT_EQ(propertyChanges, (QList<GtObject*>{child}));
+}
+
+TEST_F(TestGtObjectChangeBatch, nested)
+{
+    {
+        GtObjectChangeBatch outer;
+        {
+            GtObjectChangeBatch inner;
+            child->setDouble(1.0);
+        }
+
+        EXPECT_TRUE(propertyChanges.isEmpty());
+
+        child->setDouble(2.0);
+    }
+
+    EXPECT_EQ(propertyChanges.size(), 1);
+
+    // no batch active
+    child->setDouble(3.0);
+    child->setDouble(4.0);
+    EXPECT_EQ(propertyChanges.size(), 3);
+}
+
+TEST_F(TestGtObjectChangeBatch, deletedObject)
+{
+    {
+        GtObjectChangeBatch batch;
+        child->setDouble(1.0);
+        root.setDouble(1.0);
+        delete child;
+    }
+
+    EXPECT_EQ(propertyChanges, (QList<GtObject*>{&root}));
+}
+
+TEST_F(TestGtObjectChangeBatch, mementoCache)
+{
+    GtObjectMementoCache cache;
+    cache.store(root, root.toMemento());
+
+    GtObjectChangeBatch batch;
+    child->setDouble(42.0);
+
+    // pending changes are journaled
+    EXPECT_FALSE(cache.commit(root).isNull());
+}
+
+TEST_F(TestGtObjectChangeBatch, applyDiff)
+{
+    GtObjectMemento before = root.toMemento();
+    child->setDouble(1.0);
+    child->setInt(1);
+    GtObjectMementoDiff diff(before, root.toMemento());
+
+    objectChanges.clear();
+    propertyChanges.clear();
+
+    ASSERT_TRUE(root.revertDiff(diff));
+    EXPECT_EQ(objectChanges, (QList<GtObject*>{child}));
+    EXPECT_TRUE(propertyChanges.isEmpty());
+}
@@ -0,0 +1,174 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_objectchangedispatcher.h"
+#include "gt_objectchangebatch.h"
+#include "test_gt_object.h"
+
+#include <algorithm>
+
+/// This is a test fixture that does a init for each test
+class TestGtObjectChangeDispatcher : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        root.setObjectName("Root");
+
+        child = new TestSpecialGtObject;
+        child->setObjectName("Child");
+        root.appendChild(child);
+
+        subChild = new TestSpecialGtObject;
+        subChild->setObjectName("SubChild");
+        child->appendChild(subChild);
+    }
+
+    /// Returns a callback recording the changed objects
+    GtObjectChangeDispatcher::Callback recorder(QList<GtObject*>& changes)
+    {
+        return [&changes](GtObject* obj, GtAbstractProperty*) {
+            changes.append(obj);
+        };
+    }
+
+    TestSpecialGtObject root;
+    TestSpecialGtObject* child{};
+    TestSpecialGtObject* subChild{};
+};
+
+TEST_F(TestGtObjectChangeDispatcher, subtree)
+{
+    QList<GtObject*> rootChanges;
+    QList<GtObject*> childChanges;
+
+    auto s1 = GtObjectChangeDispatcher::subscribe(root, recorder(rootChanges));
+    auto s2 = GtObjectChangeDispatcher::subscribe(*child,
+                                                  recorder(childChanges));
+    EXPECT_TRUE(s1.isActive());
+    EXPECT_EQ(GtObjectChangeDispatcher::numberOfSubscriptions(root), 1);
+
+    subChild->setDouble(1.0);
+    root.setDouble(1.0);
+    child->setObjectName("Renamed");
+
+    EXPECT_EQ(rootChanges, (QList<GtObject*>{subChild, &root, child}));
+    EXPECT_EQ(childChanges, (QList<GtObject*>{subChild, child}));
+
+    // parents are marked as changed
+    EXPECT_TRUE(child->objectFlags().testFlag(GtObject::HasChildChanges));
+
+    s2.unsubscribe();
+    EXPECT_FALSE(s2.isActive());
+    EXPECT_EQ(GtObjectChangeDispatcher::numberOfSubscriptions(*child), 0);
+
+    subChild->setDouble(2.0);
+    EXPECT_EQ(rootChanges.size(), 4);
+    EXPECT_EQ(childChanges.size(), 2);
+}
+
+TEST_F(TestGtObjectChangeDispatcher, filter)
+{
+    QList<GtObject*> changes;
+
+    auto s = GtObjectChangeDispatcher::subscribe(
+        root, recorder(changes),
+        [](const GtObject*, const GtAbstractProperty* p) {
+            return p && p->ident() == QStringLiteral("intProp");
+    });
+
+    subChild->setDouble(1.0);
+    subChild->setInt(1);
+    child->setObjectName("Renamed");
+
+    ASSERT_FALSE(changes.isEmpty());
+    EXPECT_TRUE(std::all_of(changes.begin(), changes.end(),
+                            [this](GtObject* obj) { return obj == subChild; }));
+}
+
+TEST_F(TestGtObjectChangeDispatcher, reparenting)
+{
+    QList<GtObject*> changes;
+    auto s = GtObjectChangeDispatcher::subscribe(*child, recorder(changes));
+
+    TestSpecialGtObject other;
+    other.appendChild(subChild);
+    changes.clear();
+
+    subChild->setDouble(1.0);
+    EXPECT_TRUE(changes.isEmpty());
+
+    child->appendChild(subChild);
+    changes.clear();
+
+    subChild->setDouble(2.0);
+    EXPECT_EQ(changes, (QList<GtObject*>{subChild}));
+}
+
+TEST_F(TestGtObjectChangeDispatcher, deletedRoot)
+{
+    QList<GtObject*> changes;
+    auto s = GtObjectChangeDispatcher::subscribe(*child, recorder(changes));
+
+    delete child;
+    EXPECT_FALSE(s.isActive());
+
+    root.setDouble(1.0);
+    EXPECT_TRUE(changes.isEmpty());
+}
+
+TEST_F(TestGtObjectChangeDispatcher, parentSignals)
+{
+    // signals of the parents are still emitted
+    QList<GtObject*> changes;
+    QObject::connect(&root, qOverload<GtObject*, GtAbstractProperty*>(
+                         &GtObject::dataChanged),
+                     [&changes](GtObject* obj, GtAbstractProperty*) {
+        changes.append(obj);
+    });
+
+    subChild->setDouble(1.0);
+    EXPECT_FALSE(changes.isEmpty());
+    EXPECT_EQ(changes.first(), subChild);
+}
+
+TEST_F(TestGtObjectChangeDispatcher, batch)
+{
+    QList<GtObject*> changes;
+    auto s = GtObjectChangeDispatcher::subscribe(root, recorder(changes));
+
+    {
+        GtObjectChangeBatch batch;
+        subChild->setDouble(1.0);
+        subChild->setDouble(2.0);
+        EXPECT_TRUE(changes.isEmpty());
+    }
+
+    EXPECT_EQ(changes, (QList<GtObject*>{subChild}));
+}
+
+TEST_F(TestGtObjectChangeDispatcher, notifyDataChanged)
+{
+    QList<GtObject*> changes;
+    auto s = GtObjectChangeDispatcher::subscribe(root, recorder(changes));
+
+    QList<GtObject*> parentChanges;
+    QObject::connect(child, qOverload<GtObject*>(&GtObject::dataChanged),
+                     [&parentChanges](GtObject* obj) {
+        parentChanges.append(obj);
+    });
+
+    // emitting the signal directly only reaches receivers of the object
+    emit subChild->dataChanged(subChild);
+    EXPECT_TRUE(changes.isEmpty());
+    EXPECT_TRUE(parentChanges.isEmpty());
+
+    subChild->notifyDataChanged();
+    EXPECT_EQ(changes, QList<GtObject*>{subChild});
+    EXPECT_EQ(parentChanges, QList<GtObject*>{subChild});
+}
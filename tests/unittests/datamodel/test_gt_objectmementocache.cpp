@@ -0,0 +1,337 @@
+/* GTlab - Gas Turbine laboratory
+ *
+ * SPDX-License-Identifier: MPL-2.0+
+ * SPDX-FileCopyrightText: 2023 German Aerospace Center (DLR)
+ */
+
+#include "gtest/gtest.h"
+
+#include "gt_objectmementocache.h"
+#include "gt_objectmemento.h"
+#include "gt_objectmementodiff.h"
+#include "gt_objectfactory.h"
+#include "test_gt_object.h"
+
+#include <memory>
+
+namespace
+{
+
+/// String property counting how often its value is serialized
+class CountingStringProperty : public GtStringProperty
+{
+public:
+    using GtStringProperty::GtStringProperty;
+
+    QVariant valueToVariant(const QString& unit,
+                            bool* success = nullptr) const override
+    {
+        ++calls;
+        return GtStringProperty::valueToVariant(unit, success);
+    }
+
+    mutable int calls{0};
+};
+
+/// Object without meta properties, hence its hash is cached
+class CountingObject : public GtObject
+{
+public:
+    CountingObject()
+    {
+        registerProperty(prop);
+    }
+
+    CountingStringProperty prop{"value", "Value"};
+};
+
+} // namespace
+
+/// This is a test fixture that does a init for each test
+class TestGtObjectMementoCache : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!gtObjectFactory->knownClass("TestSpecialGtObject"))
+        {
+            gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+        }
+
+        root.setObjectName("Root");
+
+        for (int i = 0; i < 3; ++i)
+        {
+            auto* child = new TestSpecialGtObject;
+            child->setObjectName(QStringLiteral("Child_%1").arg(i));
+            root.appendChild(child);
+
+            auto* subChild = new TestSpecialGtObject;
+            subChild->setObjectName(QStringLiteral("SubChild_%1").arg(i));
+            child->appendChild(subChild);
+        }
+    }
+
+    /// Whether the cached memento equals a freshly created memento
+    bool isUpToDate()
+    {
+        GtObjectMemento cached = cache.memento(root);
+        GtObjectMemento fresh = root.toMemento();
+
+        cached.calculateHashes();
+        fresh.calculateHashes();
+
+        return cached.fullHash() == fresh.fullHash();
+    }
+
+    TestSpecialGtObject root;
+    GtObjectMementoCache cache;
+};
+
+TEST_F(TestGtObjectMementoCache, unchanged)
+{
+    EXPECT_FALSE(cache.contains(root));
+
+    GtObjectMemento memento = root.toMemento();
+    cache.store(root, memento);
+
+    EXPECT_TRUE(cache.contains(root));
+    EXPECT_TRUE(isUpToDate());
+
+    GtObjectMementoDiff diff(memento, cache.memento(root));
+    EXPECT_TRUE(diff.isNull());
+}
+
+TEST_F(TestGtObjectMementoCache, propertyChanged)
+{
+    cache.store(root, root.toMemento());
+
+    auto* subChild = root.findChild<TestSpecialGtObject*>("SubChild_1");
+    ASSERT_TRUE(subChild);
+    subChild->setDouble(42.0);
+
+    EXPECT_TRUE(isUpToDate());
+}
+
+TEST_F(TestGtObjectMementoCache, objectRenamed)
+{
+    cache.store(root, root.toMemento());
+
+    auto* child = root.findDirectChild<TestSpecialGtObject*>("Child_2");
+    ASSERT_TRUE(child);
+    child->setObjectName("Renamed");
+
+    EXPECT_TRUE(isUpToDate());
+}
+
+TEST_F(TestGtObjectMementoCache, childrenAddedRemovedAndMoved)
+{
+    cache.store(root, root.toMemento());
+
+    auto* child0 = root.findDirectChild<TestSpecialGtObject*>("Child_0");
+    auto* child1 = root.findDirectChild<TestSpecialGtObject*>("Child_1");
+    ASSERT_TRUE(child0);
+    ASSERT_TRUE(child1);
+
+    // move sub child to other parent
+    auto* subChild = child0->findDirectChild<TestSpecialGtObject*>();
+    ASSERT_TRUE(subChild);
+    child1->appendChild(subChild);
+    EXPECT_TRUE(isUpToDate());
+
+    // new child including a sub child
+    auto* newChild = new TestSpecialGtObject;
+    newChild->setObjectName("New");
+    newChild->appendChild(new TestSpecialGtObject);
+    child0->appendChild(newChild);
+    EXPECT_TRUE(isUpToDate());
+
+    // removed child
+    delete child1;
+    EXPECT_TRUE(isUpToDate());
+}
+
+TEST_F(TestGtObjectMementoCache, storeUpdatedMemento)
+{
+    cache.store(root, root.toMemento());
+
+    auto* subChild = root.findChild<TestSpecialGtObject*>("SubChild_0");
+    ASSERT_TRUE(subChild);
+
+    subChild->setInt(1);
+    GtObjectMemento before = cache.memento(root);
+    cache.store(root, before);
+
+    subChild->setInt(2);
+    GtObjectMemento after = cache.memento(root);
+
+    GtObjectMementoDiff diff(before, after);
+    EXPECT_FALSE(diff.isNull());
+    EXPECT_TRUE(isUpToDate());
+}
+
+TEST_F(TestGtObjectMementoCache, commitJournaledChanges)
+{
+    // first commit only stores the state
+    EXPECT_TRUE(cache.commit(root).isNull());
+    EXPECT_FALSE(cache.hasChanges());
+
+    GtObjectMemento initial = root.toMemento();
+    initial.calculateHashes();
+
+    auto* subChild = root.findChild<TestSpecialGtObject*>("SubChild_2");
+    auto* child = root.findDirectChild<TestSpecialGtObject*>("Child_0");
+    ASSERT_TRUE(subChild);
+    ASSERT_TRUE(child);
+
+    subChild->setDouble(13.0);
+    child->appendChild(new TestSpecialGtObject);
+    EXPECT_TRUE(cache.hasChanges());
+
+    GtObjectMementoDiff diff = cache.commit(root);
+    EXPECT_FALSE(diff.isNull());
+    EXPECT_FALSE(cache.hasChanges());
+    EXPECT_TRUE(isUpToDate());
+
+    GtObjectMemento changed = root.toMemento();
+    changed.calculateHashes();
+
+    // undo
+    ASSERT_TRUE(root.revertDiff(diff));
+
+    GtObjectMemento reverted = root.toMemento();
+    reverted.calculateHashes();
+    EXPECT_EQ(reverted.fullHash(), initial.fullHash());
+
+    // redo
+    ASSERT_TRUE(root.applyDiff(diff));
+
+    GtObjectMemento applied = root.toMemento();
+    applied.calculateHashes();
+    EXPECT_EQ(applied.fullHash(), changed.fullHash());
+}
+
+TEST_F(TestGtObjectMementoCache, unsignaledChangeBeforeCommand)
+{
+    cache.commit(root);
+
+    auto* subChild = root.findChild<TestSpecialGtObject*>("SubChild_1");
+    auto* child = root.findDirectChild<TestSpecialGtObject*>("Child_2");
+    ASSERT_TRUE(subChild);
+    ASSERT_TRUE(child);
+
+    // the property does not emit a signal
+    subChild->setDoubleVec({1.0, 2.0});
+    EXPECT_FALSE(cache.hasChanges());
+
+    // start of the command, the change is detected by its hash
+    EXPECT_FALSE(cache.commit(root).isNull());
+    EXPECT_TRUE(isUpToDate());
+
+    GtObjectMemento before = root.toMemento();
+    before.calculateHashes();
+
+    child->setDouble(7.0);
+
+    // end of the command
+    GtObjectMementoDiff diff = cache.commit(root);
+    EXPECT_FALSE(diff.isNull());
+
+    GtObjectMemento after = root.toMemento();
+    after.calculateHashes();
+
+    // undo keeps the change made before the command
+    ASSERT_TRUE(root.revertDiff(diff));
+
+    GtObjectMemento reverted = root.toMemento();
+    reverted.calculateHashes();
+    EXPECT_EQ(reverted.fullHash(), before.fullHash());
+    EXPECT_EQ(subChild->getDoubleVec(), (QVector<double>{1.0, 2.0}));
+
+    // redo
+    ASSERT_TRUE(root.applyDiff(diff));
+
+    GtObjectMemento applied = root.toMemento();
+    applied.calculateHashes();
+    EXPECT_EQ(applied.fullHash(), after.fullHash());
+}
+
+TEST_F(TestGtObjectMementoCache, changesOutsideOfCommands)
+{
+    auto* subChild = root.findChild<TestSpecialGtObject*>("SubChild_0");
+    auto* child = root.findDirectChild<TestSpecialGtObject*>("Child_1");
+    ASSERT_TRUE(subChild);
+    ASSERT_TRUE(child);
+
+    // first command
+    cache.commit(root);
+    child->setDouble(3.0);
+    GtObjectMementoDiff first = cache.commit(root);
+    EXPECT_FALSE(first.isNull());
+
+    // changes between the commands
+    subChild->setDoubleVec({4.0});
+    subChild->setInt(5);
+
+    GtObjectMemento between = root.toMemento();
+    between.calculateHashes();
+
+    // second command, with a change that is not signaled
+    cache.commit(root);
+    std::unique_ptr<GtObject> removed{child->findDirectChild<GtObject*>()};
+    ASSERT_TRUE(removed);
+    removed->setParent(nullptr);
+    subChild->setDouble(6.0);
+    GtObjectMementoDiff second = cache.commit(root);
+    EXPECT_FALSE(second.isNull());
+    EXPECT_FALSE(cache.hasChanges());
+
+    GtObjectMemento after = root.toMemento();
+    after.calculateHashes();
+
+    // undo of the second command keeps the changes between the commands
+    ASSERT_TRUE(root.revertDiff(second));
+
+    GtObjectMemento reverted = root.toMemento();
+    reverted.calculateHashes();
+    EXPECT_EQ(reverted.fullHash(), between.fullHash());
+    EXPECT_EQ(subChild->getDoubleVec(), QVector<double>{4.0});
+    EXPECT_EQ(subChild->getInt(), 5);
+    EXPECT_EQ(child->childObjects().size(), 1);
+
+    // redo
+    ASSERT_TRUE(root.applyDiff(second));
+
+    GtObjectMemento applied = root.toMemento();
+    applied.calculateHashes();
+    EXPECT_EQ(applied.fullHash(), after.fullHash());
+    EXPECT_TRUE(child->childObjects().isEmpty());
+}
+
+TEST_F(TestGtObjectMementoCache, unchangedObjectsAreNotSerializedAgain)
+{
+    GtObject tree;
+
+    auto* unchanged = new CountingObject;
+    unchanged->setObjectName("Unchanged");
+    tree.appendChild(unchanged);
+
+    auto* changed = new CountingObject;
+    changed->setObjectName("Changed");
+    tree.appendChild(changed);
+
+    // first command
+    cache.commit(tree);
+    changed->prop.setVal("first");
+    EXPECT_FALSE(cache.commit(tree).isNull());
+
+    unchanged->prop.calls = 0;
+
+    // second command, the state before is neither serialized nor hashed
+    EXPECT_TRUE(cache.commit(tree).isNull());
+    changed->prop.setVal("second");
+    EXPECT_FALSE(cache.commit(tree).isNull());
+
+    EXPECT_EQ(unchanged->prop.calls, 0);
+    EXPECT_TRUE(cache.contains(tree));
+}
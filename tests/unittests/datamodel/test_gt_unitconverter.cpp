@@ -3989,3 +3989,44 @@ TEST_F(TestGtUnitConverter, convertDataSizeFrom)
     ASSERT_DOUBLE_EQ(valFtlbf, 14000);
 }
 
+
+TEST_F(TestGtUnitConverter, conversion)
+{
+    bool check = false;
+
+    auto conv = m_conv->conversion(GtUnit::Temperature, "°F", &check);
+
+    ASSERT_TRUE(check);
+    ASSERT_TRUE(conv.isValid());
+
+    // same results as the scalar conversion
+    for (double val : {0.0, 273.15, 300.0, -12.5})
+    {
+        ASSERT_EQ(conv.to(val), m_conv->To(GtUnit::Temperature, "°F", val));
+        ASSERT_EQ(conv.from(val),
+                  m_conv->from(GtUnit::Temperature, "°F", val));
+    }
+
+    // batch conversion
+    QVector<double> values{0.0, 273.15, 300.0, -12.5, 1.0};
+    QVector<double> result(values.size());
+
+    conv.to(values.constData(), result.data(), values.size());
+    for (int i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(result[i], conv.to(values[i]));
+    }
+
+    // in place
+    conv.from(result.constData(), result.data(), result.size());
+    for (int i = 0; i < values.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ(result[i], values[i]);
+    }
+
+    // unknown unit
+    conv = m_conv->conversion(GtUnit::Length, "°F", &check);
+
+    ASSERT_FALSE(check);
+    ASSERT_FALSE(conv.isValid());
+}
@@ -12,8 +12,20 @@
 
 #include "gt_objectio.h"
 #include "gt_objectmemento.h"
+#include "gt_objectfactory.h"
+#include "gt_package.h"
+#include "gt_xmlutilities.h"
+#include "gt_xmlexpr.h"
+#include "gt_objectmementodiff.h"
+
+#include "test_gt_object.h"
+
+#include <QXmlStreamWriter>
+#include <QXmlStreamReader>
 
 #include <iostream>
+#include <limits>
+#include <cstring>
 
 /// This is a test fixture
 struct TestGtObjectIO_Read : public ::testing::Test
@@ -94,3 +106,312 @@ TEST_F(TestGtObjectIO_Read, invalidQVariant)
     EXPECT_FALSE(variant.isValid());
 }
 
+
+namespace
+{
+
+struct TestPackage : public GtPackage
+{
+    bool usesDefaultDataFormat() const override { return true; }
+};
+
+struct TestDomPackage : public GtPackage
+{
+    bool readData(const QDomElement& root) override
+    {
+        ++nReadDataCalls;
+        return GtPackage::readData(root);
+    }
+
+    bool saveData(QDomElement& root, QDomDocument& doc) override
+    {
+        ++nSaveDataCalls;
+        GtPackage::saveData(root, doc);
+        root.setAttribute("custom", "true");
+        root.appendChild(doc.createElement("custom"));
+        return true;
+    }
+
+    int nReadDataCalls{0};
+    int nSaveDataCalls{0};
+};
+
+QString
+writeDom(GtPackage& package)
+{
+    QDomDocument doc;
+    QDomElement root = doc.createElement("GTLABMODULE");
+    root.setAttribute("uuid", package.uuid());
+    package.saveData(root, doc);
+
+    QString str;
+    QXmlStreamWriter writer(&str);
+    writer.setAutoFormatting(true);
+    gt::xml::writeDomElementOrderedAttribute(root, writer);
+
+    return str;
+}
+
+QString
+writeStream(GtPackage& package)
+{
+    QString str;
+    QXmlStreamWriter writer(&str);
+    writer.setAutoFormatting(true);
+    writer.writeStartElement("GTLABMODULE");
+    package.saveDataToStream(writer);
+    writer.writeEndElement();
+
+    return str;
+}
+
+void
+fillPackage(GtPackage& package)
+{
+    gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+    gtObjectFactory->registerClass(TestObject::staticMetaObject);
+
+    auto* obj = new TestSpecialGtObject;
+    obj->setObjectName("Special");
+    obj->setBool(true);
+    obj->setDouble(0.1);
+    obj->setInt(42);
+    obj->setString("str");
+    obj->setDoubleVec({0.1, 0.2, 1e-17});
+    obj->findProperty("intProp")->setActive(false);
+    package.appendChild(obj);
+
+    auto* child = new TestObject;
+    child->addEnvironmentVar("PATH", "/usr/bin\r\n/bin");
+    obj->appendChild(child);
+
+    new GtObjectGroup(&package);
+}
+
+} // namespace
+
+TEST(TestGtObjectIO_Write, streamEqualsDom)
+{
+    TestPackage package;
+    fillPackage(package);
+
+    QString dom = writeDom(package);
+    QString stream = writeStream(package);
+
+    EXPECT_FALSE(stream.isEmpty());
+    EXPECT_EQ(dom.toStdString(), stream.toStdString());
+}
+
+TEST(TestGtObjectIO_Write, streamReimplementedSaveData)
+{
+    TestDomPackage package;
+    fillPackage(package);
+
+    QString dom = writeDom(package);
+    QString stream = writeStream(package);
+
+    EXPECT_TRUE(stream.contains("<custom/>"));
+
+    // module attributes are sorted
+    EXPECT_TRUE(stream.contains(
+        QStringLiteral("<GTLABMODULE custom=\"true\" uuid=\"%1\">")
+            .arg(package.uuid())));
+    EXPECT_EQ(dom.toStdString(), stream.toStdString());
+
+    // saveData is called once per save
+    EXPECT_EQ(package.nSaveDataCalls, 2);
+}
+
+class TestThreadSafePackage : public GtPackage
+{
+    Q_OBJECT
+    Q_CLASSINFO("threadSafe", "true")
+};
+
+TEST(TestGtObjectIO_Write, threadSafeIsOptIn)
+{
+    TestThreadSafePackage threadSafe;
+    EXPECT_TRUE(threadSafe.isThreadSafe());
+    EXPECT_TRUE(GtPackage::isThreadSafe(
+        TestThreadSafePackage::staticMetaObject));
+
+    // packages are read and saved serially unless declared thread safe
+    TestPackage package;
+    EXPECT_FALSE(package.isThreadSafe());
+    EXPECT_FALSE(GtPackage::isThreadSafe(GtPackage::staticMetaObject));
+}
+
+TEST(TestGtObjectIO_Write, defaultFormatIsOptIn)
+{
+    // packages keep the dom based format unless they opt in
+    TestDomPackage domPackage;
+    EXPECT_FALSE(domPackage.usesDefaultDataFormat());
+
+    TestPackage package;
+    EXPECT_TRUE(package.usesDefaultDataFormat());
+}
+
+namespace
+{
+
+bool
+readStream(GtPackage& package, const QString& str)
+{
+    QXmlStreamReader reader(str);
+
+    if (!reader.readNextStartElement())
+    {
+        return false;
+    }
+
+    return package.readDataFromStream(reader);
+}
+
+} // namespace
+
+TEST(TestGtObjectIO_StreamRead, readEqualsWritten)
+{
+    TestPackage package;
+    fillPackage(package);
+    gtObjectFactory->registerClass(GtObjectGroup::staticMetaObject);
+
+    QString str = writeStream(package);
+
+    TestPackage loaded;
+    ASSERT_TRUE(readStream(loaded, str));
+
+    ASSERT_EQ(loaded.childObjects().size(), 2);
+
+    auto* obj = loaded.findDirectChild<TestSpecialGtObject*>("Special");
+    ASSERT_TRUE(obj != nullptr);
+    EXPECT_EQ(obj->uuid(), package.findDirectChild<TestSpecialGtObject*>(
+                               "Special")->uuid());
+    EXPECT_FALSE(obj->findProperty("intProp")->isActive());
+    ASSERT_EQ(obj->findDirectChildren<TestObject*>().size(), 1);
+
+    EXPECT_EQ(writeStream(loaded).toStdString(), str.toStdString());
+}
+
+TEST(TestGtObjectIO_StreamRead, mergeDefaultObject)
+{
+    TestPackage package;
+    fillPackage(package);
+
+    QString str = writeStream(package);
+
+    TestPackage loaded;
+    auto* defaultObj = new TestSpecialGtObject;
+    defaultObj->setObjectName("Special");
+    defaultObj->setDefault(true);
+    loaded.appendChild(defaultObj);
+
+    ASSERT_TRUE(readStream(loaded, str));
+
+    // the data is merged into the default object
+    EXPECT_EQ(loaded.findDirectChildren<TestSpecialGtObject*>().size(), 1);
+    EXPECT_EQ(loaded.findDirectChild<TestSpecialGtObject*>("Special"),
+              defaultObj);
+    EXPECT_EQ(defaultObj->findDirectChildren<TestObject*>().size(), 1);
+}
+
+TEST(TestGtObjectIO_StreamRead, unknownClassIsDummy)
+{
+    auto str = R"(
+    <GTLABMODULE uuid="{module}">
+     <object class="UnknownStreamClass" name="Unknown" uuid="{unknown}">
+      <property name="value" type="double">1.5</property>
+      <objectlist>
+       <object class="UnknownStreamClass" name="Child" uuid="{child}"/>
+      </objectlist>
+     </object>
+    </GTLABMODULE>
+    )";
+
+    TestPackage loaded;
+    ASSERT_TRUE(readStream(loaded, str));
+
+    auto* obj = loaded.findDirectChild<GtObject*>("Unknown");
+    ASSERT_TRUE(obj != nullptr);
+    EXPECT_TRUE(obj->isDummy());
+
+    GtObjectMemento memento = obj->toMemento();
+    EXPECT_EQ(memento.className(), "UnknownStreamClass");
+    EXPECT_EQ(memento.childObjects.size(), 1);
+}
+
+TEST(TestGtObjectIO_StreamRead, reimplementedFormatUsesDom)
+{
+    TestDomPackage package;
+    fillPackage(package);
+
+    QString str = writeStream(package);
+
+    TestDomPackage loaded;
+    ASSERT_TRUE(readStream(loaded, str));
+    EXPECT_EQ(loaded.nReadDataCalls, 1);
+
+    EXPECT_EQ(writeStream(loaded).toStdString(), str.toStdString());
+}
+
+TEST(TestGtObjectIO_BinaryList, roundTrip)
+{
+    TestPackage package;
+    fillPackage(package);
+
+    QVector<double> values{0.1, -0.0, 1e-310, 1.0 / 3.0,
+                           std::numeric_limits<double>::max(),
+                           std::numeric_limits<double>::infinity()};
+
+    auto* obj = package.findDirectChild<TestSpecialGtObject*>("Special");
+    obj->setDoubleVec(values);
+
+    gt::xml::setBinaryListThreshold(2);
+    QString str = writeStream(package);
+    QString dom = writeDom(package);
+    gt::xml::setBinaryListThreshold(0);
+
+    EXPECT_TRUE(str.contains(gt::xml::S_DOUBLE_BASE64_TYPE));
+    EXPECT_EQ(dom.toStdString(), str.toStdString());
+
+    TestPackage loaded;
+    ASSERT_TRUE(readStream(loaded, str));
+
+    auto* loadedObj = loaded.findDirectChild<TestSpecialGtObject*>("Special");
+    ASSERT_TRUE(loadedObj != nullptr);
+
+    // values are restored bit-exactly
+    QVector<double> loadedValues = loadedObj->getDoubleVec();
+    ASSERT_EQ(loadedValues.size(), values.size());
+    EXPECT_EQ(std::memcmp(loadedValues.constData(), values.constData(),
+                          values.size() * sizeof(double)), 0);
+
+    // lists are written as text by default
+    EXPECT_FALSE(writeStream(loaded).contains(gt::xml::S_DOUBLE_BASE64_TYPE));
+}
+
+TEST(TestGtObjectIO_BinaryList, diff)
+{
+    gtObjectFactory->registerClass(TestSpecialGtObject::staticMetaObject);
+
+    TestSpecialGtObject obj;
+    obj.setDoubleVec({1.0});
+    GtObjectMemento before = obj.toMemento();
+
+    QVector<double> values{0.1, 0.2, 0.3};
+    obj.setDoubleVec(values);
+    GtObjectMemento after = obj.toMemento();
+
+    gt::xml::setBinaryListThreshold(2);
+    GtObjectMementoDiff diff(before, after);
+    gt::xml::setBinaryListThreshold(0);
+
+    EXPECT_TRUE(diff.toByteArray().contains(gt::xml::S_DOUBLE_BASE64_TYPE));
+
+    ASSERT_TRUE(obj.revertDiff(diff));
+    EXPECT_EQ(obj.getDoubleVec(), QVector<double>{1.0});
+
+    ASSERT_TRUE(obj.applyDiff(diff));
+    EXPECT_EQ(obj.getDoubleVec(), values);
+}
+
+#include "test_gtobjectio.moc"
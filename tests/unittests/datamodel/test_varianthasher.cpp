@@ -8,6 +8,8 @@
 
 #include <gtest/gtest.h>
 
+#include <QPointF>
+
 
 
 struct TestVariantHasher : public testing::Test
@@ -67,3 +69,62 @@ TEST_F(TestVariantHasher, testIssue386)
     ASSERT_EQ(r1.result().toStdString(), a1.result().toStdString());
     ASSERT_EQ(r2.result().toStdString(), a2.result().toStdString());
 }
+
+TEST_F(TestVariantHasher, fastHashChunks)
+{
+    QByteArray data(100, 'a');
+    for (int i = 0; i < data.size(); ++i) data[i] = static_cast<char>(i);
+
+    gt::detail::FastHash full;
+    full.addData(data);
+
+    // result does not depend on how the data was added
+    for (int split : {0, 1, 15, 16, 17, 50, 99, 100})
+    {
+        gt::detail::FastHash chunked;
+        chunked.addData(data.left(split));
+        chunked.addData(data.mid(split));
+
+        EXPECT_EQ(chunked.result(), full.result());
+    }
+
+    EXPECT_EQ(full.result().size(), gt::detail::FastHash::S_HASH_SIZE);
+
+    gt::detail::FastHash other;
+    other.addData(data.left(99));
+    EXPECT_NE(other.result(), full.result());
+
+    other.reset();
+    other.addData(data);
+    EXPECT_EQ(other.result(), full.result());
+}
+
+TEST_F(TestVariantHasher, fastHashVariants)
+{
+    gt::detail::VariantHasher hasher;
+
+    auto hash = [&hasher](const QVariant& v){
+        gt::detail::FastHash h;
+        hasher.addToHash(h, v);
+        return h.result();
+    };
+
+    // we don't distinguish between empty and null strings
+    EXPECT_EQ(hash(QString()), hash(QString("")));
+    EXPECT_NE(hash(QString("a")), hash(QString("b")));
+
+    EXPECT_EQ(hash(1.5), hash(1.5));
+    EXPECT_NE(hash(1.5), hash(2.5));
+    EXPECT_NE(hash(1), hash(true));
+
+    QVector<double> vec{1., 2., 3.};
+    EXPECT_EQ(hash(QVariant::fromValue(vec)), hash(QVariant::fromValue(vec)));
+    EXPECT_NE(hash(QVariant::fromValue(vec)),
+              hash(QVariant::fromValue(QVector<double>{1., 2.})));
+
+    EXPECT_NE(hash(QStringList{"ab", "c"}), hash(QStringList{"a", "bc"}));
+
+    // other types are serialized
+    EXPECT_EQ(hash(QPointF(1, 2)), hash(QPointF(1, 2)));
+    EXPECT_NE(hash(QPointF(1, 2)), hash(QPointF(2, 1)));
+}